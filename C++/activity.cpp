@@ -0,0 +1,152 @@
+/*
+ *  Voisus SDK Example radio activity sampler
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "activity.h"
+#include "refresh.h"
+#include <atomic>
+#include <chrono>
+
+// Each slot is a small seqlock: the sampler clears seq, writes the packed
+// event and then stores seq as the event number + 1. A reader that sees the
+// same expected seq before and after reading the event has a whole copy.
+typedef struct {
+    std::atomic<uint64_t> seq;
+    std::atomic<uint64_t> event;
+} SLOT_T;
+
+static SLOT_T Ring[ACTIVITY_CAPACITY];
+static std::atomic<uint64_t> Head;     // Events written
+static std::shared_ptr<const std::vector<unsigned char> > Sampled;
+static const std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+
+// Packs time:44 radio:16 transmit:1 on:1
+static uint64_t pack(uint64_t time_us, int radio, int transmit, int on)
+{
+    return (time_us << 20) | ((uint64_t)(radio & 0xffff) << 4) | (transmit << 1) | on;
+}
+
+static ActivityEvent unpack(uint64_t word)
+{
+    ActivityEvent event;
+    event.time_us = word >> 20;
+    event.radio = (int)((word >> 4) & 0xffff);
+    event.transmit = (int)((word >> 1) & 1);
+    event.on = (int)(word & 1);
+    return event;
+}
+
+static void append(uint64_t word)
+{
+    uint64_t n = Head.load(std::memory_order_relaxed);
+    SLOT_T& slot = Ring[n % ACTIVITY_CAPACITY];
+    slot.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event.store(word, std::memory_order_relaxed);
+    slot.seq.store(n + 1, std::memory_order_release);
+    Head.store(n + 1, std::memory_order_release);
+}
+
+uint64_t activity_now_us(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - Epoch).count();
+}
+
+void activity_sample(const std::shared_ptr<const std::vector<unsigned char> >& flags)
+{
+    if (!flags || (flags == Sampled))
+        return;
+    uint64_t now = activity_now_us();
+    for (size_t i = 0; i < flags->size(); i++)
+    {   unsigned char previous = (Sampled && (i < Sampled->size())) ? (*Sampled)[i] : 0;
+        unsigned char changed = previous ^ (*flags)[i];
+        if (changed & RADIO_RECEIVING)
+            append(pack(now, (int)i, 0, ((*flags)[i] & RADIO_RECEIVING) != 0));
+        if (changed & RADIO_TRANSMITTING)
+            append(pack(now, (int)i, 1, ((*flags)[i] & RADIO_TRANSMITTING) != 0));
+    }
+    Sampled = flags;
+}
+
+uint64_t activity_read(uint64_t& cursor, std::vector<ActivityEvent>& events)
+{
+    uint64_t head = Head.load(std::memory_order_acquire);
+    uint64_t lost = 0;
+    if (head - cursor > ACTIVITY_CAPACITY)
+    {   lost = head - ACTIVITY_CAPACITY - cursor;
+        cursor = head - ACTIVITY_CAPACITY;
+    }
+    for (; cursor < head; cursor++)
+    {   SLOT_T& slot = Ring[cursor % ACTIVITY_CAPACITY];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        uint64_t word = slot.event.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((seq != cursor + 1) || (slot.seq.load(std::memory_order_relaxed) != seq))
+        {   lost++;     // Overwritten while reading
+            continue;
+        }
+        events.push_back(unpack(word));
+    }
+    return lost;
+}
+
+uint64_t activity_duty(uint64_t since_us, const std::vector<unsigned char>& flags,
+                       std::vector<ActivityDuty>& duty)
+{
+    std::vector<ActivityEvent> events;
+    uint64_t cursor = 0;
+    uint64_t now = activity_now_us();
+    if (activity_read(cursor, events) && !events.empty() && (events[0].time_us > since_us))
+        since_us = events[0].time_us;
+    if (since_us > now)
+        since_us = now;
+
+    // Per radio and signal: on time so far and time of the last rising edge.
+    // A falling edge with no rising edge before it was on from the start.
+    std::vector<uint64_t> on_us(flags.size() * 2);
+    std::vector<uint64_t> start_us(flags.size() * 2, since_us);
+    duty.assign(flags.size(), ActivityDuty());
+    for (size_t i = 0; i < events.size(); i++)
+    {   const ActivityEvent& event = events[i];
+        if ((event.time_us < since_us) || (event.radio >= (int)flags.size()))
+            continue;
+        size_t s = event.radio * 2 + event.transmit;
+        if (event.on)
+        {   start_us[s] = event.time_us;
+            (event.transmit ? duty[event.radio].tx_count : duty[event.radio].rx_count)++;
+        }
+        else
+            on_us[s] += event.time_us - start_us[s];
+    }
+    uint64_t window = now - since_us;
+    for (size_t r = 0; r < flags.size(); r++)
+    {   for (int transmit = 0; transmit < 2; transmit++)
+        {   size_t s = r * 2 + transmit;
+            // The current flags tell whether the signal is still on
+            if (flags[r] & (transmit ? RADIO_TRANSMITTING : RADIO_RECEIVING))
+                on_us[s] += now - start_us[s];
+            double fraction = window ? (double)on_us[s] / window : 0;
+            (transmit ? duty[r].tx : duty[r].rx) = fraction;
+        }
+    }
+    return window;
+}
@@ -0,0 +1,80 @@
+/*
+ *  Voisus SDK Example radio activity sampler
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef ACTIVITY_H
+#define ACTIVITY_H
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+/// A radio starting or stopping receive or transmit
+struct ActivityEvent
+{
+    uint64_t            time_us;            ///< Time since the sampler started
+    int                 radio;              ///< Radio index
+    int                 transmit;           ///< 1 for transmit, 0 for receive
+    int                 on;                 ///< 1 on a rising edge, 0 on a falling edge
+};
+
+/// Receive and transmit duty cycle of one radio over a window
+struct ActivityDuty
+{
+    double              rx;                 ///< Fraction of the window spent receiving
+    double              tx;                 ///< Fraction of the window spent transmitting
+    unsigned int        rx_count;           ///< Receptions started in the window
+    unsigned int        tx_count;           ///< Transmissions started in the window
+};
+
+/// @brief Records edges between the last sampled radio flags and these
+/// @details Called by the refresh engine after every poll of the radio flags.
+/// Unchanged flags are shared, so an idle tick costs one pointer compare.
+/// Events go to a fixed ring of ACTIVITY_CAPACITY entries, the oldest being
+/// overwritten.
+/// @param flags ::RadioFlag_t bits per radio
+/// @note Must be called from the thread that owns libvrcc.
+void activity_sample(const std::shared_ptr<const std::vector<unsigned char> >& flags);
+
+/// Number of events retained by the ring
+#define ACTIVITY_CAPACITY 4096
+
+/// @brief Gets the current time on the sampler's clock
+uint64_t activity_now_us(void);
+
+/// @brief Copies events recorded after a cursor, oldest first
+/// @details Lock-free, safe to call from any thread while the sampler writes.
+/// @param cursor Events already read, 0 for everything retained; advanced
+/// past the events returned
+/// @returns number of events lost because the ring overwrote them first
+uint64_t activity_read(uint64_t& cursor, std::vector<ActivityEvent>& events);
+
+/// @brief Computes the duty cycle of every radio since a time
+/// @param since_us Window start on the sampler's clock, moved up to the
+/// oldest retained event if older events were overwritten
+/// @param flags Current ::RadioFlag_t bits, giving the state of radios
+/// without events in the window
+/// @returns window length in us
+uint64_t activity_duty(uint64_t since_us, const std::vector<unsigned char>& flags,
+                       std::vector<ActivityDuty>& duty);
+
+#endif
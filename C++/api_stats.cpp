@@ -0,0 +1,122 @@
+/*
+ *  Voisus SDK Example API call statistics
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "api_stats.h"
+#include <stddef.h>
+
+#define MAX_API_STATS 256
+
+static ApiStat* Stats[MAX_API_STATS];
+static std::atomic<int> Stat_count(0);
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+int LatencyHistogram::bucket(uint64_t ns)
+{
+    if (ns < SUB_BUCKETS)
+        return (int)ns;
+    int msb = 63;
+    while (!(ns & (1ULL << msb)))
+        msb--;
+    int shift = msb - SUB_BITS;
+    return SUB_BUCKETS + shift * SUB_BUCKETS + (int)((ns >> shift) - SUB_BUCKETS);
+}
+
+uint64_t LatencyHistogram::bucket_high(int bucket)
+{
+    if (bucket < SUB_BUCKETS)
+        return bucket;
+    int shift = (bucket - SUB_BUCKETS) / SUB_BUCKETS;
+    uint64_t low = (uint64_t)(SUB_BUCKETS + (bucket % SUB_BUCKETS)) << shift;
+    return low + (1ULL << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t ns)
+{
+    // Single writer, so plain load/store pairs are enough
+    std::atomic<uint64_t>& slot = counts[bucket(ns)];
+    slot.store(slot.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    total_count.store(total_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    total_ns.store(total_ns.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+    if (ns > max_ns.load(std::memory_order_relaxed))
+        max_ns.store(ns, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::reset(void)
+{
+    for (int i = 0; i < BUCKETS; i++)
+        counts[i].store(0, std::memory_order_relaxed);
+    total_count.store(0, std::memory_order_relaxed);
+    total_ns.store(0, std::memory_order_relaxed);
+    max_ns.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::percentile(double percentile) const
+{
+    uint64_t total = count();
+    if (0 == total)
+        return 0;
+    uint64_t rank = (uint64_t)(percentile / 100.0 * total + 0.5);
+    if (rank < 1)
+        rank = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++)
+    {   seen += counts[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+            return (bucket_high(i) < max()) ? bucket_high(i) : max();
+    }
+    return max();
+}
+
+ApiStat* api_stat_register(const char* name)
+{
+    int count = Stat_count.load(std::memory_order_relaxed);
+    if (count == MAX_API_STATS)
+    {   // Shares the last entry rather than failing the call
+        return Stats[MAX_API_STATS - 1];
+    }
+    ApiStat* stat = new ApiStat;
+    stat->name = name;
+    Stats[count] = stat;
+    Stat_count.store(count + 1, std::memory_order_release);
+    return stat;
+}
+
+int api_stat_count(void)
+{
+    return Stat_count.load(std::memory_order_acquire);
+}
+
+const ApiStat* api_stat_get(int index)
+{
+    return ((index >= 0) && (index < api_stat_count())) ? Stats[index] : NULL;
+}
+
+void api_stats_reset(void)
+{
+    for (int i = 0; i < api_stat_count(); i++)
+        Stats[i]->latency.reset();
+}
@@ -0,0 +1,125 @@
+/*
+ *  Voisus SDK Example API call statistics
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef API_STATS_H
+#define API_STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+
+/// @brief Log-linear latency histogram
+/// @details Values below 2^SUB_BITS nanoseconds are counted exactly; above
+/// that every power of two is split into 2^SUB_BITS buckets, so a reported
+/// value is within about 3% of the recorded one. Counters are written by a
+/// single thread and may be read from any thread.
+class LatencyHistogram
+{
+public:
+    enum { SUB_BITS = 5,
+           SUB_BUCKETS = 1 << SUB_BITS,
+           BUCKETS = SUB_BUCKETS + (64 - SUB_BITS) * SUB_BUCKETS };
+
+    LatencyHistogram();
+    void record(uint64_t ns);
+    void reset(void);
+    uint64_t count(void) const { return total_count.load(std::memory_order_relaxed); }
+    uint64_t total(void) const { return total_ns.load(std::memory_order_relaxed); }
+    uint64_t max(void) const { return max_ns.load(std::memory_order_relaxed); }
+
+    /// @brief Gets the value at a percentile
+    /// @param percentile value in range [0.0, 100.0]
+    /// @returns highest value equivalent to the percentile's bucket, in ns
+    uint64_t percentile(double percentile) const;
+
+private:
+    static int bucket(uint64_t ns);
+    static uint64_t bucket_high(int bucket);
+
+    std::atomic<uint64_t> counts[BUCKETS];
+    std::atomic<uint64_t> total_count;
+    std::atomic<uint64_t> total_ns;
+    std::atomic<uint64_t> max_ns;
+};
+
+/// Latency statistics for one libvrcc function
+struct ApiStat
+{
+    const char*         name;               ///< Function name
+    LatencyHistogram    latency;            ///< Call latency in ns
+};
+
+/// @brief Gets the statistics entry for a function, creating it on first use
+/// @note Entries are only created on the libvrcc thread.
+ApiStat* api_stat_register(const char* name);
+
+/// @brief Gets the number of functions with statistics
+int api_stat_count(void);
+
+/// @brief Gets the statistics for a function by index
+/// @see api_stat_count
+const ApiStat* api_stat_get(int index);
+
+/// @brief Clears all statistics
+/// @note Must be called from the libvrcc thread.
+void api_stats_reset(void);
+
+/// Records the lifetime of the scope into an ApiStat
+class ApiScope
+{
+public:
+    explicit ApiScope(ApiStat* stat)
+        : stat(stat), start(std::chrono::steady_clock::now()) {}
+    ~ApiScope()
+    {   stat->latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+
+private:
+    ApiStat* stat;
+    std::chrono::steady_clock::time_point start;
+};
+
+/// @brief Calls a libvrcc function and records its latency
+/// @see VRCC_TIMED
+template <typename F, F func> class ApiTimer;
+
+template <typename R, typename... A, R (*func)(A...)>
+class ApiTimer<R (*)(A...), func>
+{
+public:
+    explicit ApiTimer(const char* name) : name(name) {}
+    R operator()(A... args) const
+    {   static ApiStat* stat = api_stat_register(name);
+        ApiScope scope(stat);
+        return func(args...);
+    }
+
+private:
+    const char* name;
+};
+
+/// Wraps a libvrcc function in an ApiTimer, e.g. VRCC_TIMED(Radio_Name)(0)
+#define VRCC_TIMED(func) ApiTimer<decltype(&func), &func>(#func)
+
+#endif
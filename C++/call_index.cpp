@@ -0,0 +1,134 @@
+/*
+ *  Voisus SDK Example call and endpoint index
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "call_index.h"
+#include <string.h>
+
+static const CallKey No_endpoint = {0, 0};
+
+static int hex_digit(char c)
+{
+    if ((c >= '0') && (c <= '9'))
+        return c - '0';
+    if ((c >= 'a') && (c <= 'f'))
+        return c - 'a' + 10;
+    if ((c >= 'A') && (c <= 'F'))
+        return c - 'A' + 10;
+    return -1;
+}
+
+// FNV-1a over the ID with two offset bases, one per half
+static void hash_key(const char* id, CallKey& key)
+{
+    key.hi = 14695981039346656037ull;
+    key.lo = 0x6c62272e07bb0142ull;
+    for (const unsigned char* p = (const unsigned char*)id; *p; p++)
+    {   key.hi = (key.hi ^ *p) * 1099511628211ull;
+        key.lo = (key.lo ^ *p) * 1099511628211ull;
+    }
+}
+
+int call_key(const char* id, CallKey& key)
+{
+    key.hi = key.lo = 0;
+    int i = 0;
+    for (; (i < 32) && id[i]; i++)
+    {   int digit = hex_digit(id[i]);
+        if (digit < 0)
+            break;
+        uint64_t& half = (i < 16) ? key.hi : key.lo;
+        half = (half << 4) | (uint64_t)digit;
+    }
+    if ((32 == i) && !id[i])
+        return 1;
+    hash_key(id, key);
+    return 0;
+}
+
+// Keys are random hex, so a couple of multiplies mix them well enough
+static size_t slot_of(const CallKey& call, const CallKey& endpoint, size_t mask)
+{
+    uint64_t h = (call.hi ^ (call.lo * 0x9e3779b97f4a7c15ull)) +
+                 (endpoint.hi ^ (endpoint.lo * 0xc2b2ae3d27d4eb4full)) * 0x165667b19e3779f9ull;
+    return (size_t)(h ^ (h >> 29)) & mask;
+}
+
+void CallIndex::reset(size_t entries)
+{
+    size_t size = 4;
+    while (size < entries * 2)
+        size *= 2;
+    Slot empty;
+    memset(&empty, 0, sizeof(empty));
+    empty.call_index = -1;
+    slots.assign(size, empty);
+}
+
+void CallIndex::add(const Slot& slot)
+{
+    size_t mask = slots.size() - 1;
+    size_t s = slot_of(slot.call, slot.endpoint, mask);
+    while ((slots[s].call_index != -1) &&
+           ((slots[s].call != slot.call) || (slots[s].endpoint != slot.endpoint)))
+        s = (s + 1) & mask;
+    // An ID listed twice keeps its first position, as a linear scan would
+    if (slots[s].call_index == -1)
+        slots[s] = slot;
+}
+
+void CallIndex::add_call(const CallKey& call, int call_index)
+{
+    Slot slot = {call, No_endpoint, call_index, -1};
+    add(slot);
+}
+
+void CallIndex::add_endpoint(const CallKey& call, const CallKey& endpoint, int call_index, int endpoint_index)
+{
+    Slot slot = {call, endpoint, call_index, endpoint_index};
+    add(slot);
+}
+
+const CallIndex::Slot* CallIndex::find(const CallKey& call, const CallKey& endpoint) const
+{
+    if (slots.empty())
+        return NULL;
+    size_t mask = slots.size() - 1;
+    for (size_t s = slot_of(call, endpoint, mask); slots[s].call_index != -1; s = (s + 1) & mask)
+    {   if ((slots[s].call == call) && (slots[s].endpoint == endpoint))
+            return &slots[s];
+    }
+    return NULL;
+}
+
+int CallIndex::find_call(const CallKey& call) const
+{
+    const Slot* slot = find(call, No_endpoint);
+    return slot ? slot->call_index : -1;
+}
+
+int CallIndex::find_endpoint(const CallKey& call, const CallKey& endpoint, int& call_index) const
+{
+    const Slot* slot = find(call, endpoint);
+    call_index = slot ? slot->call_index : -1;
+    return slot ? slot->endpoint_index : -1;
+}
@@ -0,0 +1,86 @@
+/*
+ *  Voisus SDK Example call and endpoint index
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef CALL_INDEX_H
+#define CALL_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/// Call or endpoint ID as a 128-bit key
+struct CallKey
+{
+    uint64_t            hi;
+    uint64_t            lo;
+
+    bool operator==(const CallKey& other) const { return (hi == other.hi) && (lo == other.lo); }
+    bool operator!=(const CallKey& other) const { return !(*this == other); }
+};
+
+/// @brief Gets the key of a call or endpoint ID
+/// @details libvrcc IDs are 32 hex digits and decode exactly. Any other ID
+/// is hashed instead, which could in principle collide.
+/// @returns 1 if the ID decoded, 0 if it was hashed
+int call_key(const char* id, CallKey& key);
+
+/// @brief Index from call key, or call and endpoint keys, to positions in a call list
+/// @details Built once per call refresh. An open-addressing table sized to
+/// at least twice the entry count, so lookups probe about one slot.
+class CallIndex
+{
+public:
+    /// @brief Empties the index and sizes it for a number of calls plus endpoints
+    void reset(size_t entries);
+
+    /// @brief Adds a call
+    void add_call(const CallKey& call, int call_index);
+
+    /// @brief Adds an endpoint of a call
+    void add_endpoint(const CallKey& call, const CallKey& endpoint, int call_index, int endpoint_index);
+
+    /// @brief Finds a call
+    /// @returns call index, or -1 if there is no such call
+    int find_call(const CallKey& call) const;
+
+    /// @brief Finds an endpoint of a call
+    /// @param call_index Receives the call index
+    /// @returns endpoint index within the call, or -1 if there is no such endpoint
+    int find_endpoint(const CallKey& call, const CallKey& endpoint, int& call_index) const;
+
+private:
+    struct Slot
+    {
+        CallKey call;
+        CallKey endpoint;                   // Zero for the call itself
+        int call_index;                     // -1 for an empty slot
+        int endpoint_index;
+    };
+
+    void add(const Slot& slot);
+    const Slot* find(const CallKey& call, const CallKey& endpoint) const;
+
+    std::vector<Slot> slots;
+};
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ *  Voisus SDK Example call setup load generator
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "call_storm.h"
+#include "snapshot.h"
+#include "vrcc_thread.h"
+#include "vrcc_timed.h"
+#include <chrono>
+#include <thread>
+
+typedef std::chrono::steady_clock Clock;
+
+typedef struct {
+    std::string id;
+    const StormTarget* target;
+    Clock::time_point invited;
+    Clock::time_point connected;
+    int is_connected;
+} STORM_CALL_T;
+
+static uint64_t elapsed_ns(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+void call_storm_run(const StormConfig& config, StormResult& result)
+{
+    result.create.reset();
+    result.connect.reset();
+    result.created = result.failed = result.connected = result.timed_out = 0;
+    std::vector<STORM_CALL_T> live;
+    Clock::time_point start = Clock::now();
+    unsigned long sequence = 0;
+    int launched = 0;
+    while ((launched < config.calls) || !live.empty())
+    {   Clock::time_point now = Clock::now();
+        // Catch up on the schedule, so a slow Call_Create does not lower the rate
+        double due = std::chrono::duration<double>(now - start).count() * config.rate;
+        while ((launched < config.calls) && (launched < due))
+        {   STORM_CALL_T call;
+            call.target = config.targets.empty() ? NULL : &config.targets[launched % config.targets.size()];
+            call.is_connected = 0;
+            uint64_t create_ns = 0;
+            vrcc_call([&] {
+                Clock::time_point before = Clock::now();
+                call.id = Call_Create();
+                create_ns = elapsed_ns(before, Clock::now());
+                if (call.id.empty() || !call.target)
+                    return;
+                if (call.target->dial.empty())
+                    Call_Invite(call.id.c_str(), call.target->endpoint_id.c_str());
+                else
+                    Call_Invite_Dial(call.id.c_str(), call.target->endpoint_id.c_str(), call.target->dial.c_str());
+                call.invited = Clock::now();
+            });
+            launched++;
+            if (call.id.empty())
+            {   result.failed++;
+                continue;
+            }
+            result.create.record(create_ns);
+            result.created++;
+            if (!call.target)
+            {   call.is_connected = 1;
+                call.connected = call.invited = Clock::now();
+            }
+            live.push_back(call);
+        }
+
+        now = Clock::now();
+        {   SnapshotReader snap;
+            if (snap->sequence != sequence)
+            {   sequence = snap->sequence;
+                for (size_t i = 0; i < live.size(); i++)
+                {   STORM_CALL_T& call = live[i];
+                    if (!call.is_connected && (CALL_STATE_CONNECTED ==
+                        snap->calls->endpoint_state(call.id.c_str(), call.target->endpoint_id.c_str())))
+                    {   call.is_connected = 1;
+                        call.connected = now;
+                        result.connect.record(elapsed_ns(call.invited, now));
+                        result.connected++;
+                    }
+                }
+            }
+        }
+
+        for (size_t i = live.size(); i-- > 0; )
+        {   STORM_CALL_T& call = live[i];
+            int held = call.is_connected && (now - call.connected >= std::chrono::milliseconds(config.hold_ms));
+            int expired = !call.is_connected && (now - call.invited >= std::chrono::milliseconds(config.timeout_ms));
+            if (!held && !expired)
+                continue;
+            if (expired)
+                result.timed_out++;
+            std::string id = call.id;
+            vrcc_post([id] { Call_Leave(id.c_str(), CALL_LEAVE_HANG_UP); });
+            live.erase(live.begin() + i);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    result.elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
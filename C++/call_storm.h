@@ -0,0 +1,70 @@
+/*
+ *  Voisus SDK Example call setup load generator
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef CALL_STORM_H
+#define CALL_STORM_H
+
+#include "api_stats.h"
+#include <string>
+#include <vector>
+
+/// Endpoint invited to each storm call
+struct StormTarget
+{
+    std::string         endpoint_id;        ///< Unique ID of the endpoint
+    std::string         dial;               ///< Number for Call_Invite_Dial, empty for Call_Invite
+};
+
+/// Call storm settings
+struct StormConfig
+{
+    int                 calls;              ///< Calls to create
+    double              rate;               ///< Calls created per second
+    int                 hold_ms;            ///< Time a call stays up once connected
+    int                 timeout_ms;         ///< Time to wait for connected before leaving anyway
+    std::vector<StormTarget> targets;       ///< Invited round-robin, one per call
+};
+
+/// Call storm results
+struct StormResult
+{
+    LatencyHistogram    create;             ///< Call_Create() time, ns
+    LatencyHistogram    connect;            ///< Call_Invite to the target's CALL_STATE_CONNECTED, ns
+    int                 created;            ///< Calls Call_Create() returned an ID for
+    int                 failed;             ///< Calls Call_Create() returned no ID for
+    int                 connected;          ///< Calls whose target connected
+    int                 timed_out;          ///< Calls left before their target connected
+    double              elapsed_ms;         ///< Whole run
+};
+
+/// @brief Creates calls at a fixed rate, invites a target to each and hangs up
+/// @details Each call is created with the blocking Call_Create() on the
+/// libvrcc thread, then its target is invited. Progress is read from the
+/// snapshot call table, so the time to connected is as fine as the update
+/// tick. A call is left with Call_Leave once it has been up for hold_ms,
+/// or after timeout_ms if its target never connected. Returns once every
+/// call has been left.
+/// @note Call from any thread but the libvrcc thread.
+void call_storm_run(const StormConfig& config, StormResult& result);
+
+#endif
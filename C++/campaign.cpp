@@ -0,0 +1,260 @@
+/*
+ *  Voisus SDK Example jammer campaign scheduler
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "campaign.h"
+#include "jammer_tracker.h"
+#include "timer_wheel.h"
+#include "vrcc_timed.h"
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static TimerWheel Wheel;
+static std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+static uint64_t Start_ms;
+static size_t Actions;
+static std::vector<double> Late_ms;         // Per fired action
+
+static double now_ms(void)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Epoch).count();
+}
+
+static int is_number(const char* text)
+{
+    size_t len = strlen(text);
+    return len && (len < 10) && (strspn(text, "0123456789") == len);
+}
+
+// Parses <jammer>, <first>-<last> or * into a range
+static int parse_jammers(const char* text, int count, int& first, int& last)
+{
+    if (!strcmp(text, "*"))
+    {   first = 0;
+        last = count - 1;
+        return count > 0;
+    }
+    char lo[16] = "";
+    char hi[16] = "";
+    if (2 == sscanf(text, "%15[0-9]-%15[0-9]", lo, hi))
+    {   first = atoi(lo);
+        last = atoi(hi);
+    }
+    else if (is_number(text))
+        first = last = atoi(text);
+    else
+        return 0;
+    return (first <= last) && (last < count);
+}
+
+// Parses the fields of one campaign line, adding an action per jammer
+static int parse_line(char* text, int line, const Snapshot& snap, std::vector<CampaignAction>& actions,
+                      char* error, size_t errsz)
+{
+    const std::vector<JammerInfo>& jammers = *snap.jammers;
+    const char* at = strtok(text, " \t");
+    const char* target = strtok(NULL, " \t");
+    const char* op = target ? strtok(NULL, " \t") : NULL;
+    const char* arg = op ? strtok(NULL, " \t") : NULL;
+    if (!op)
+    {   snprintf(error, errsz, "expected <ms> <jammer> <action>");
+        return 0;
+    }
+    if (strspn(at, "0123456789") != strlen(at))
+    {   snprintf(error, errsz, "bad time %s", at);
+        return 0;
+    }
+    int first, last;
+    if (!parse_jammers(target, (int)jammers.size(), first, last))
+    {   snprintf(error, errsz, "no jammer %s", target);
+        return 0;
+    }
+    CampaignAction action;
+    action.at_ms = strtoull(at, NULL, 10);
+    action.arg = 0;
+    action.line = line;
+    int ok = 1;
+    if (!strcmp(op, "net"))
+        action.op = CAMPAIGN_NET;
+    else if (!strcmp(op, "enable"))
+    {   action.op = CAMPAIGN_ENABLE;
+        ok = arg && (!strcmp(arg, "on") || !strcmp(arg, "off"));
+        action.arg = ok && !strcmp(arg, "on");
+    }
+    else if (!strcmp(op, "record"))
+    {   action.op = CAMPAIGN_RECORD;
+        ok = arg && is_number(arg) && ((action.arg = atoi(arg)) > 0);
+    }
+    else if (!strcmp(op, "replay"))
+    {   action.op = CAMPAIGN_REPLAY;
+        ok = arg && (!strcmp(arg, "loop") || !strcmp(arg, "play"));
+        action.arg = ok && !strcmp(arg, "loop");
+    }
+    else if (!strcmp(op, "stop"))
+        action.op = CAMPAIGN_STOP;
+    else if (!strcmp(op, "stop_recording"))
+        action.op = CAMPAIGN_STOP_RECORDING;
+    else if (!strcmp(op, "stop_replaying"))
+        action.op = CAMPAIGN_STOP_REPLAYING;
+    else
+    {   snprintf(error, errsz, "unknown action %s", op);
+        return 0;
+    }
+    if (!ok || ((CAMPAIGN_NET == action.op) && !arg))
+    {   snprintf(error, errsz, "bad argument for %s", op);
+        return 0;
+    }
+    if (strtok(NULL, " \t"))
+    {   snprintf(error, errsz, "too many arguments for %s", op);
+        return 0;
+    }
+    for (int jammer = first; jammer <= last; jammer++)
+    {   action.jammer = jammer;
+        if (CAMPAIGN_NET == action.op)
+        {   const JammerInfo& info = jammers[jammer];
+            int net = is_number(arg) ? atoi(arg) : info.net_index.find(arg);
+            if ((net < 0) || (net >= (int)info.nets.size()))
+            {   snprintf(error, errsz, "jammer %d has no net %s", jammer, arg);
+                return 0;
+            }
+            action.net_id = info.nets[net].id;
+        }
+        actions.push_back(action);
+    }
+    return 1;
+}
+
+int campaign_load(const char* path, const Snapshot& snap, std::vector<CampaignAction>& actions,
+                  char* error, size_t errsz)
+{
+    FILE* file = fopen(path, "r");
+    if (!file)
+    {   snprintf(error, errsz, "Cannot open %s.", path);
+        return 0;
+    }
+    char text[512];
+    char reason[128];
+    int ok = 1;
+    for (int line = 1; ok && fgets(text, sizeof(text), file); line++)
+    {   text[strcspn(text, "#\r\n")] = '\0';
+        if (!text[strspn(text, " \t")])
+            continue;
+        ok = parse_line(text, line, snap, actions, reason, sizeof(reason));
+        if (!ok)
+            snprintf(error, errsz, "%s:%d: %s.", path, line, reason);
+    }
+    fclose(file);
+    return ok;
+}
+
+static void fire(const CampaignAction& action, uint64_t due_ms)
+{
+    Late_ms.push_back(std::max(0.0, now_ms() - due_ms));
+    int jammer = action.jammer;
+    switch (action.op)
+    {
+    case CAMPAIGN_NET:
+        Jammer_SetNetID(jammer, action.net_id.c_str());
+        break;
+    case CAMPAIGN_ENABLE:
+        Jammer_SetEnable(jammer, action.arg);
+        break;
+    case CAMPAIGN_RECORD:
+        Jammer_StartRecording(jammer, action.arg);
+        jammer_track_start(jammer);
+        break;
+    case CAMPAIGN_REPLAY:
+        Jammer_StartReplaying(jammer, action.arg);
+        jammer_track_start(jammer);
+        break;
+    case CAMPAIGN_STOP_RECORDING:
+        Jammer_StopRecording(jammer);
+        break;
+    case CAMPAIGN_STOP_REPLAYING:
+        Jammer_StopReplaying(jammer);
+        break;
+    case CAMPAIGN_STOP:
+        if (JAMMER_STATE_REPLAYING == Jammer_RecordReplayState(jammer))
+            Jammer_StopReplaying(jammer);
+        else
+            Jammer_StopRecording(jammer);
+        break;
+    }
+}
+
+void campaign_start(const std::vector<CampaignAction>& actions)
+{
+    // The wheel counts whole ms and only fires timers after its current one,
+    // so start it a ms early for actions at 0 to go out now
+    Start_ms = (uint64_t)now_ms();
+    Wheel.reset(Start_ms - 1);
+    Actions = actions.size();
+    Late_ms.clear();
+    Late_ms.reserve(actions.size());
+    for (size_t i = 0; i < actions.size(); i++)
+    {   const CampaignAction& action = actions[i];
+        uint64_t due_ms = Start_ms + action.at_ms;
+        Wheel.schedule(due_ms, [action, due_ms] { fire(action, due_ms); });
+    }
+    campaign_run();
+}
+
+void campaign_stop(void)
+{
+    Wheel.reset((uint64_t)now_ms());
+}
+
+void campaign_run(void)
+{
+    if (Wheel.pending())
+        Wheel.advance((uint64_t)now_ms());
+}
+
+long long campaign_next_ms(void)
+{
+    return Wheel.next_ms((uint64_t)now_ms());
+}
+
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.empty())
+        return 0;
+    return sorted[std::min(sorted.size() - 1, (size_t)(p / 100.0 * sorted.size()))];
+}
+
+CampaignStatus campaign_status(void)
+{
+    CampaignStatus status;
+    std::vector<double> sorted(Late_ms);
+    std::sort(sorted.begin(), sorted.end());
+    status.running = Wheel.pending() > 0;
+    status.actions = Actions;
+    status.fired = Late_ms.size();
+    status.elapsed_ms = Actions ? now_ms() - Start_ms : 0;
+    status.late_p50_ms = percentile(sorted, 50.0);
+    status.late_p99_ms = percentile(sorted, 99.0);
+    status.late_max_ms = sorted.empty() ? 0 : sorted.back();
+    return status;
+}
@@ -0,0 +1,108 @@
+/*
+ *  Voisus SDK Example jammer campaign scheduler
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef CAMPAIGN_H
+#define CAMPAIGN_H
+
+#include "snapshot.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/// Jammer action in a campaign
+enum CampaignOp_t
+{
+    CAMPAIGN_NET,                           ///< Jammer_SetNetID
+    CAMPAIGN_ENABLE,                        ///< Jammer_SetEnable
+    CAMPAIGN_RECORD,                        ///< Jammer_StartRecording, arg is the duration in seconds
+    CAMPAIGN_REPLAY,                        ///< Jammer_StartReplaying, arg is 1 to loop
+    CAMPAIGN_STOP_RECORDING,                ///< Jammer_StopRecording
+    CAMPAIGN_STOP_REPLAYING,                ///< Jammer_StopReplaying
+    CAMPAIGN_STOP,                          ///< Whichever of the two stops matches the jammer's state
+};
+
+/// One timestamped action on one jammer
+struct CampaignAction
+{
+    uint64_t            at_ms;              ///< Time from the campaign start
+    int                 jammer;             ///< Jammer index
+    int                 op;                 ///< ::CampaignOp_t
+    int                 arg;                ///< Enable, duration or loop
+    std::string         net_id;             ///< Net for CAMPAIGN_NET
+    int                 line;               ///< Line in the campaign file
+};
+
+/// Progress of the running or last campaign
+struct CampaignStatus
+{
+    int                 running;            ///< 1 while actions are pending
+    size_t              actions;            ///< Actions scheduled
+    size_t              fired;              ///< Actions fired so far
+    double              elapsed_ms;         ///< Time since the campaign started
+    double              late_p50_ms;        ///< Median time an action fired after its timestamp
+    double              late_p99_ms;
+    double              late_max_ms;
+};
+
+/// @brief Loads a campaign
+/// @details One action per line, "#" starts a comment:
+///
+///     <ms> <jammer>|<first>-<last>|* net <net>
+///     <ms> <jammers> enable on|off
+///     <ms> <jammers> record <seconds>
+///     <ms> <jammers> replay loop|play
+///     <ms> <jammers> stop|stop_recording|stop_replaying
+///
+/// Times are ms from the campaign start, in any order. Nets are an index or
+/// a net ID, resolved against the snapshot's jammers. A line naming several
+/// jammers becomes one action per jammer.
+/// @param error Receives a message when the campaign is rejected
+/// @returns 1 on success, 0 on error
+int campaign_load(const char* path, const Snapshot& snap, std::vector<CampaignAction>& actions,
+                  char* error, size_t errsz);
+
+/// @brief Schedules a campaign to start now, replacing any running one
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+void campaign_start(const std::vector<CampaignAction>& actions);
+
+/// @brief Drops the pending actions of the running campaign
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+void campaign_stop(void);
+
+/// @brief Fires the actions that are due
+/// @details Called on every update tick, before VRCC_Update() so the calls
+/// go out on the same tick.
+/// @note Must be called from the thread that owns libvrcc.
+void campaign_run(void);
+
+/// @brief Gets how long until the next action is due, for the reactor
+/// @returns ms, or -1 when no campaign is running
+/// @note Must be called from the thread that owns libvrcc.
+long long campaign_next_ms(void);
+
+/// @brief Gets the progress of the running or last campaign
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+CampaignStatus campaign_status(void);
+
+#endif
@@ -0,0 +1,223 @@
+/*
+ *  Voisus SDK Example comm plan snapshots
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "comm_plan.h"
+#include "vrcc_timed.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef WIN32
+    #include <stdlib.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+static void copy_id(char* dst, size_t size, const char* src)
+{
+    strncpy(dst, src ? src : "", size - 1);
+}
+
+void comm_plan_capture(std::vector<char>& image)
+{
+    uint32_t radios = (uint32_t)Radio_ListCount();
+    uint32_t jammers = (uint32_t)Jammer_ListCount();
+    image.assign(sizeof(CommPlanHeader) + radios * sizeof(CommPlanRadio) +
+                 jammers * sizeof(CommPlanJammer), 0);
+
+    CommPlanHeader* header = (CommPlanHeader*)&image[0];
+    memcpy(header->magic, COMM_PLAN_MAGIC, sizeof(header->magic));
+    header->version = COMM_PLAN_VERSION;
+    header->bom = COMM_PLAN_BOM;
+    header->radio_count = radios;
+    header->radio_offset = sizeof(CommPlanHeader);
+    header->radio_size = sizeof(CommPlanRadio);
+    header->jammer_count = jammers;
+    header->jammer_offset = header->radio_offset + radios * sizeof(CommPlanRadio);
+    header->jammer_size = sizeof(CommPlanJammer);
+    header->headset.earphone_volume = Headset_EarphoneVolume();
+    header->headset.mic_volume = Headset_MicVolume();
+    header->headset.sidetone_volume = Headset_SidetoneVolume();
+    header->headset.vox_threshold = Headset_VoxThreshold();
+    header->headset.mic_mode = Headset_MicrophoneMode();
+    header->headset.has_sidetone = Headset_HasSidetone();
+
+    CommPlanRadio* radio = (CommPlanRadio*)&image[header->radio_offset];
+    for (int i = 0; i < (int)radios; i++, radio++)
+    {   copy_id(radio->name, sizeof(radio->name), Radio_Name(i));
+        copy_id(radio->net_id, sizeof(radio->net_id), Radio_NetIDActive(i));
+        copy_id(radio->effects, sizeof(radio->effects), Radio_RadioEffects(i));
+        copy_id(radio->playsound, sizeof(radio->playsound), Radio_Playsound(i));
+        radio->rx_frequency = Radio_NetRxFrequencyActive(i);
+        radio->tx_frequency = Radio_NetTxFrequencyActive(i);
+        radio->crypto_system = Radio_NetCryptoSystemActive(i);
+        radio->crypto_key = Radio_NetCryptoKeyActive(i);
+        radio->volume = Radio_Volume(i);
+        radio->volume_left = Radio_VolumeStereoLeft(i);
+        radio->volume_right = Radio_VolumeStereoRight(i);
+        radio->balance = Radio_Balance(i);
+        radio->ptt = Radio_PTT(i);
+        radio->flags = (Radio_IsReceiveEnabled(i) ? PLAN_RX_ENABLED : 0) |
+                       (Radio_IsTransmitEnabled(i) ? PLAN_TX_ENABLED : 0) |
+                       (Radio_CryptoEnabled(i) ? PLAN_CRYPTO_ENABLED : 0);
+    }
+    CommPlanJammer* jammer = (CommPlanJammer*)&image[header->jammer_offset];
+    for (int i = 0; i < (int)jammers; i++, jammer++)
+        copy_id(jammer->net_id, sizeof(jammer->net_id), Jammer_NetIDActive(i));
+}
+
+int comm_plan_check(const void* image, size_t size, char* error, size_t errsz)
+{
+    const CommPlanHeader* header = (const CommPlanHeader*)image;
+    if ((size < sizeof(CommPlanHeader)) || memcmp(header->magic, COMM_PLAN_MAGIC, sizeof(header->magic)))
+        snprintf(error, errsz, "Not a comm plan file.");
+    else if (header->bom != COMM_PLAN_BOM)
+        snprintf(error, errsz, "Comm plan was saved on a host of other byte order.");
+    else if (header->version != COMM_PLAN_VERSION)
+        snprintf(error, errsz, "Comm plan version %u is not supported.", (unsigned)header->version);
+    else if ((header->radio_size != sizeof(CommPlanRadio)) || (header->jammer_size != sizeof(CommPlanJammer)) ||
+             (header->radio_offset < sizeof(CommPlanHeader)) || (header->jammer_offset < sizeof(CommPlanHeader)) ||
+             ((uint64_t)header->radio_offset + (uint64_t)header->radio_count * header->radio_size > size) ||
+             ((uint64_t)header->jammer_offset + (uint64_t)header->jammer_count * header->jammer_size > size))
+        snprintf(error, errsz, "Comm plan file is truncated or corrupt.");
+    else
+        return 1;
+    return 0;
+}
+
+// Records are fixed-size, so a string may fill its field without a NUL
+static const char* id(const char* field, size_t size, char* buf)
+{
+    memcpy(buf, field, size);
+    buf[size - 1] = '\0';
+    return buf;
+}
+
+int comm_plan_apply(const void* image, size_t size)
+{
+    const char* base = (const char*)image;
+    const CommPlanHeader* header = (const CommPlanHeader*)base;
+    char net_id[COMM_PLAN_ID_SIZE];
+    char other[COMM_PLAN_NAME_SIZE];
+    int renamed = 0;
+    // Every record is read in place, so never trust an unchecked image
+    if (!comm_plan_check(image, size, other, sizeof(other)))
+        return -1;
+
+    Headset_SetEarphoneVolume(header->headset.earphone_volume);
+    Headset_SetMicVolume(header->headset.mic_volume);
+    if (header->headset.has_sidetone && Headset_HasSidetone())
+        Headset_SetSidetoneVolume(header->headset.sidetone_volume);
+    Headset_SetVoxThreshold(header->headset.vox_threshold);
+    Headset_SetMicrophoneMode(header->headset.mic_mode);
+
+    int radios = Radio_ListCount();
+    for (int i = 0; (i < (int)header->radio_count) && (i < radios); i++)
+    {   const CommPlanRadio* radio = (const CommPlanRadio*)(base + header->radio_offset) + i;
+        // Names longer than the field were saved truncated
+        renamed += (0 != strncmp(id(radio->name, sizeof(radio->name), other), Radio_Name(i),
+                                 sizeof(radio->name) - 1));
+        id(radio->net_id, sizeof(radio->net_id), net_id);
+        Radio_SetNetID(i, net_id);
+        if (net_id[0])
+        {   Radio_SetNetRxFrequency(i, net_id, radio->rx_frequency);
+            Radio_SetNetTxFrequency(i, net_id, radio->tx_frequency);
+            Radio_SetNetCrypto(i, net_id, radio->crypto_system, radio->crypto_key);
+        }
+        Radio_SetCryptoEnable(i, (radio->flags & PLAN_CRYPTO_ENABLED) ? 1 : 0);
+        Radio_SetVolume(i, radio->volume);
+        Radio_SetVolumeStereo(i, radio->volume_left, radio->volume_right);
+        Radio_SetBalance(i, radio->balance);
+        Radio_SetPTT(i, radio->ptt);
+        Radio_SetRadioEffects(i, id(radio->effects, sizeof(radio->effects), other));
+        Radio_SetPlaysound(i, id(radio->playsound, sizeof(radio->playsound), other));
+        Radio_SetReceiveEnabled(i, (radio->flags & PLAN_RX_ENABLED) ? 1 : 0);
+        Radio_SetTransmitEnabled(i, (radio->flags & PLAN_TX_ENABLED) ? 1 : 0);
+    }
+    int jammers = Jammer_ListCount();
+    for (int i = 0; (i < (int)header->jammer_count) && (i < jammers); i++)
+    {   const CommPlanJammer* jammer = (const CommPlanJammer*)(base + header->jammer_offset) + i;
+        Jammer_SetNetID(i, id(jammer->net_id, sizeof(jammer->net_id), net_id));
+    }
+    return renamed;
+}
+
+int comm_plan_write(const char* path, const std::vector<char>& image)
+{
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return 0;
+    int ok = (fwrite(&image[0], 1, image.size(), file) == image.size());
+    return (0 == fclose(file)) && ok;
+}
+
+#ifndef WIN32
+
+const void* comm_plan_map(const char* path, size_t& size)
+{
+    int fd = open(path, O_RDONLY);
+    if (-1 == fd)
+        return NULL;
+    struct stat st;
+    void* image = MAP_FAILED;
+    if ((0 == fstat(fd, &st)) && (st.st_size > 0))
+    {   size = (size_t)st.st_size;
+        image = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    return (MAP_FAILED == image) ? NULL : image;
+}
+
+void comm_plan_unmap(const void* image, size_t size)
+{
+    munmap((void*)image, size);
+}
+
+#else
+
+// Without mmap the file is read into memory
+const void* comm_plan_map(const char* path, size_t& size)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return NULL;
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* image = (length > 0) ? (char*)malloc(length) : NULL;
+    if (image && (fread(image, 1, length, file) != (size_t)length))
+    {   free(image);
+        image = NULL;
+    }
+    fclose(file);
+    size = (size_t)length;
+    return image;
+}
+
+void comm_plan_unmap(const void* image, size_t size)
+{
+    free((void*)image);
+}
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ *  Voisus SDK Example comm plan snapshots
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef COMM_PLAN_H
+#define COMM_PLAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/// @file
+/// A comm plan file captures the configuration of every radio, the headset
+/// and the jammer nets. The file is a header followed by fixed-size radio
+/// and jammer records at the offsets the header gives, in host byte order,
+/// so it can be mapped and read in place. IDs are NUL-padded strings.
+
+#define COMM_PLAN_MAGIC     "VSDKPLAN"
+#define COMM_PLAN_VERSION   1
+#define COMM_PLAN_BOM       0x01020304u ///< Detects a file from a host of other byte order
+#define COMM_PLAN_ID_SIZE   40          ///< Room for a 32-character ID and its NUL
+#define COMM_PLAN_NAME_SIZE 64
+
+/// Radio flags in CommPlanRadio::flags
+enum CommPlanFlag_t
+{
+    PLAN_RX_ENABLED     = 1 << 0,
+    PLAN_TX_ENABLED     = 1 << 1,
+    PLAN_CRYPTO_ENABLED = 1 << 2
+};
+
+/// Headset settings
+struct CommPlanHeadset
+{
+    float               earphone_volume;
+    float               mic_volume;
+    float               sidetone_volume;
+    float               vox_threshold;
+    int32_t             mic_mode;           ///< ::MicMode_t
+    int32_t             has_sidetone;
+};
+
+/// File header
+struct CommPlanHeader
+{
+    char                magic[8];           ///< COMM_PLAN_MAGIC, not NUL-terminated
+    uint32_t            version;            ///< COMM_PLAN_VERSION
+    uint32_t            bom;                ///< COMM_PLAN_BOM
+    uint32_t            radio_count;
+    uint32_t            radio_offset;       ///< File offset of the first CommPlanRadio
+    uint32_t            radio_size;         ///< sizeof(CommPlanRadio)
+    uint32_t            jammer_count;
+    uint32_t            jammer_offset;      ///< File offset of the first CommPlanJammer
+    uint32_t            jammer_size;        ///< sizeof(CommPlanJammer)
+    CommPlanHeadset     headset;
+};
+
+/// Configuration of one radio
+struct CommPlanRadio
+{
+    char                name[COMM_PLAN_NAME_SIZE];  ///< Checked against the radio on restore
+    char                net_id[COMM_PLAN_ID_SIZE];  ///< Active net, empty if powered off
+    char                effects[COMM_PLAN_ID_SIZE];
+    char                playsound[COMM_PLAN_ID_SIZE];
+    uint64_t            rx_frequency;       ///< Hz
+    uint64_t            tx_frequency;       ///< Hz
+    int32_t             crypto_system;
+    int32_t             crypto_key;
+    float               volume;
+    float               volume_left;
+    float               volume_right;
+    int32_t             balance;            ///< ::Balance_t
+    int32_t             ptt;
+    uint32_t            flags;              ///< ::CommPlanFlag_t bits
+};
+
+/// Configuration of one jammer
+struct CommPlanJammer
+{
+    char                net_id[COMM_PLAN_ID_SIZE];  ///< Active net
+};
+
+/// @brief Captures the current configuration as a comm plan file image
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+void comm_plan_capture(std::vector<char>& image);
+
+/// @brief Checks that a file image is a comm plan this build can read
+/// @param error Receives a message when the image is rejected
+/// @returns 1 if valid, 0 otherwise
+int comm_plan_check(const void* image, size_t size, char* error, size_t errsz);
+
+/// @brief Applies a comm plan in one pass
+/// @details Radios and jammers are matched by index; those beyond the
+/// current counts are skipped. Names are compared up to the
+/// COMM_PLAN_NAME_SIZE - 1 characters a plan can hold.
+/// @param size Size of the image, which is checked with comm_plan_check()
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+/// @returns number of radios whose name differs from the plan, -1 if the
+/// image is not a valid comm plan
+int comm_plan_apply(const void* image, size_t size);
+
+/// @brief Writes a file image
+/// @returns 1 on success, 0 on error
+int comm_plan_write(const char* path, const std::vector<char>& image);
+
+/// @brief Maps a file read-only
+/// @returns address of the mapping, NULL on error
+const void* comm_plan_map(const char* path, size_t& size);
+
+/// @brief Unmaps a file mapped by comm_plan_map
+void comm_plan_unmap(const void* image, size_t size);
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ *  Voisus SDK Example command dispatch
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/// Seeded FNV-1a hash of the first len characters of str
+constexpr uint32_t dispatch_hash(const char* str, size_t len, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (size_t i = 0; i < len; i++)
+        hash = (hash ^ (unsigned char)str[i]) * 16777619u;
+    return hash;
+}
+
+constexpr size_t dispatch_strlen(const char* str)
+{
+    size_t len = 0;
+    while (str[len])
+        len++;
+    return len;
+}
+
+constexpr int dispatch_streq(const char* a, const char* b)
+{
+    while (*a && (*a == *b))
+    {   a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+/// Smallest power of two with room for keys at a load factor of 1/8
+constexpr size_t dispatch_size(size_t keys)
+{
+    size_t size = 1;
+    while (size < 8 * keys)
+        size *= 2;
+    return size;
+}
+
+/// @brief Collision-free hash of a fixed set of names into SIZE slots
+/// @details Built at compile time by make_perfect_hash(), which searches for
+/// a seed that gives every name its own slot, so a lookup costs one hash and
+/// one string compare.
+template <size_t SIZE>
+struct PerfectHash
+{
+    static_assert(0 == (SIZE & (SIZE - 1)), "SIZE must be a power of two");
+
+    int ok = 0;                     ///< 1 if a collision-free seed was found
+    uint32_t seed = 0;              ///< Seed passed to dispatch_hash()
+    short slots[SIZE] = {};         ///< Entry index + 1 per slot, 0 if empty
+
+    /// @brief Finds the entry named by the first len characters of str
+    /// @param entries the table the hash was built from
+    /// @returns the entry, or NULL if there is none with that name
+    template <typename T, size_t N>
+    const T* find(const T (&entries)[N], const char* str, size_t len) const
+    {
+        int slot = slots[dispatch_hash(str, len, seed) & (SIZE - 1)];
+        if (0 == slot)
+            return NULL;
+        const T& entry = entries[slot - 1];
+        if ((strlen(entry.name) != len) || (0 != strncmp(entry.name, str, len)))
+            return NULL;
+        return &entry;
+    }
+};
+
+/// @brief Builds a PerfectHash over the names of a NULL-terminated table
+/// @details T needs a `const char* name` member. The result's ok member is
+/// 0 if no seed was found, e.g. because two entries share a name.
+template <size_t SIZE, typename T, size_t N>
+constexpr PerfectHash<SIZE> make_perfect_hash(const T (&entries)[N])
+{
+    PerfectHash<SIZE> table;
+    for (size_t i = 0; entries[i].name; i++)
+    {   for (size_t j = i + 1; entries[j].name; j++)
+        {   if (dispatch_streq(entries[i].name, entries[j].name))
+                return table;
+        }
+    }
+    // At a load factor of 1/8 a seed is usually found within a few dozen tries
+    for (uint32_t seed = 0; seed < 4096; seed++)
+    {   for (size_t s = 0; s < SIZE; s++)
+            table.slots[s] = 0;
+        size_t i = 0;
+        for (; entries[i].name; i++)
+        {   size_t slot = dispatch_hash(entries[i].name, dispatch_strlen(entries[i].name), seed) & (SIZE - 1);
+            if (table.slots[slot])
+                break;
+            table.slots[slot] = (short)(i + 1);
+        }
+        if (!entries[i].name)
+        {   table.ok = 1;
+            table.seed = seed;
+            return table;
+        }
+    }
+    return table;
+}
+
+#endif
@@ -0,0 +1,2788 @@
+/*
+ *  Offline libvrcc stand-in
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "fake_vrcc.h"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Simulated server state
+///////////////////////////////////////////////////////////////////////////////
+
+// Version counters, named like the refresh engine domains
+enum
+{
+    V_RADIO, V_JAMMER, V_ROLE, V_ENTITYSTATE, V_OPERATOR, V_CALL,
+    V_INVITATION, V_CLOUD, V_RADIOEFFECTS, V_AUDIODEVICE, V_PLAYSOUND, V_COUNT
+};
+
+static const char* Version_names[V_COUNT] = {
+    "radio", "jammer", "role", "entitystate", "operator", "call",
+    "invitation", "cloud", "radioeffects", "audiodevice", "playsound"};
+
+// Kinds of unique IDs
+enum
+{
+    ID_ROLE = 1, ID_NET, ID_OPERATOR, ID_CALL, ID_RADIOEFFECTS, ID_PLAYSOUND,
+    ID_ENTITYSTATE, ID_CLOUD, ID_AUDIODEVICE, ID_ENDPOINT
+};
+
+#define MAX_PTT 8
+
+struct FakeNamed
+{
+    std::string id;
+    std::string name;
+};
+
+struct FakeNet
+{
+    std::string id;
+    std::string name;
+    std::string waveform;
+    unsigned long long frequency;
+    int crypto_system;
+    int crypto_key;
+    int crypto_enabled;
+    int freq_hop_id;
+    int satcom_channel;
+    int tuning_method;
+};
+
+struct FakeRadio
+{
+    std::string name;
+    std::string effects;
+    std::string playsound;
+    std::vector<int> nets;              // Indices into the comm plan
+    int active;                         // Index into nets
+    unsigned long long rx_frequency;    // Active net frequencies
+    unsigned long long tx_frequency;
+    int crypto_system;
+    int crypto_key;
+    int crypto_enable;
+    int rx_enabled;
+    int tx_enabled;
+    int receiving;
+    int transmitting;
+    float volume;
+    float volume_left;
+    float volume_right;
+    int balance;
+    int ptt;
+    int level_enabled;
+    float level;
+};
+
+struct FakeJammer
+{
+    std::vector<int> nets;              // Indices into the comm plan
+    int active;
+    int enabled;
+    int state;
+    int progress;
+    int duration_ms;
+    int loop;
+    double start_ms;
+    double length_ms;
+};
+
+struct FakeOperator
+{
+    std::string id;
+    std::map<std::string, std::string> fields;
+};
+
+struct FakeEndpoint
+{
+    std::string id;
+    int state;
+    unsigned long answer_tick;
+};
+
+struct FakeCall
+{
+    std::string id;
+    std::vector<FakeEndpoint> endpoints;
+};
+
+struct FakeEvent
+{
+    unsigned long tick;
+    unsigned long every;
+    std::string action;
+    std::string args[3];
+};
+
+struct FakePending
+{
+    unsigned long tick;
+    std::function<void()> apply;
+};
+
+static struct FakeState
+{
+    FakeVrccConfig_t config;
+    int configured;
+    unsigned long ticks;
+    std::chrono::steady_clock::time_point start;
+    unsigned int rng;
+    int changed;
+    int versions[V_COUNT];
+
+    std::vector<FakeNet> plan;
+    std::vector<FakeNamed> roles;
+    std::vector<FakeNamed> entity_states;
+    std::vector<FakeNamed> radio_effects;
+    std::vector<FakeNamed> playsounds;
+    std::vector<FakeNamed> clouds;
+    std::vector<FakeNamed> devices[AUDIO_DEVICE_TOTAL];
+    std::string device_active[AUDIO_DEVICE_TOTAL];
+
+    std::vector<FakeRadio> radios;
+    std::vector<FakeJammer> jammers;
+    std::vector<FakeOperator> operators;
+    std::vector<FakeCall> calls;
+    std::vector<CallInvitation_t> invitations;
+    std::vector<std::string> invitation_ids;
+    std::vector<FakeEvent> events;
+    std::vector<FakePending> pending;
+    unsigned long next_call;
+
+    std::string target_ip;
+    std::string client_name;
+    std::string endpoint_id;
+    std::string cloud_set;
+    std::string cloud_active;
+    std::string phone_call;
+    std::string created_call;
+    int connection_status;
+    int connect_state;
+    int connection_mode;
+    int role_set;
+    int role_active;
+    int entity_state_set;
+    int entity_state_active;
+    int ptt[MAX_PTT];
+    int ptt_applied[MAX_PTT];
+
+    float vox_threshold;
+    int mic_mode;
+    float earphone_volume;
+    float mic_volume;
+    float sidetone_volume;
+    float phone_volume;
+    int earshot_enable;
+    int earshot_ptt;
+    int codec;
+    DISParams_t dis;
+    int exercise;
+    std::map<int, int> licenses;
+    int next_license;
+
+    size_t call_cursor;
+    size_t endpoint_cursor;
+    size_t operator_cursor;
+    size_t cloud_cursor;
+    size_t effects_cursor;
+    size_t invitation_cursor;
+    size_t device_cursor[AUDIO_DEVICE_TOTAL];
+} Fake;
+
+// Latency injection, in microseconds; -1 means use the default
+static std::map<std::string, int> Latency_slots;
+static std::vector<int> Latencies;
+static int Default_latency;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static int latency_slot(const char* function)
+{
+    std::map<std::string, int>::iterator it = Latency_slots.find(function);
+    if (it != Latency_slots.end())
+        return it->second;
+    Latencies.push_back(-1);
+    Latency_slots[function] = (int)Latencies.size() - 1;
+    return (int)Latencies.size() - 1;
+}
+
+static void fake_delay(int slot)
+{
+    int usec = (Latencies[slot] >= 0) ? Latencies[slot] : Default_latency;
+    if (usec <= 0)
+        return;
+    if (usec >= 1000)
+    {   std::this_thread::sleep_for(std::chrono::microseconds(usec));
+        return;
+    }
+    // Sleeping is too coarse for short latencies
+    std::chrono::steady_clock::time_point until =
+        std::chrono::steady_clock::now() + std::chrono::microseconds(usec);
+    while (std::chrono::steady_clock::now() < until)
+        ;
+}
+
+// Every exported function starts with this to apply its injected latency
+#define FAKE_ENTRY() \
+    static const int fake_slot = latency_slot(__func__); \
+    fake_delay(fake_slot)
+
+static int env_int(const char* name, int value)
+{
+    const char* str = getenv(name);
+    return (str && strlen(str)) ? atoi(str) : value;
+}
+
+static std::string make_id(int kind, unsigned long index)
+{
+    char buf[33];
+    snprintf(buf, sizeof(buf), "%08x%08lx%08x%08lx", kind, index, 0xa571u,
+             (index * 2654435761UL) & 0xffffffffUL);
+    return buf;
+}
+
+static unsigned int fake_rand(void)
+{
+    Fake.rng = Fake.rng * 1103515245u + 12345u;
+    return (Fake.rng >> 16) & 0x7fff;
+}
+
+static double now_ms(void)
+{
+    if (Fake.config.tick_ms > 0)
+        return (double)Fake.ticks * Fake.config.tick_ms;
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - Fake.start).count();
+}
+
+static void bump(int version)
+{
+    Fake.versions[version]++;
+    Fake.changed = 1;
+}
+
+static void bump_all(void)
+{
+    for (int v = 0; v < V_COUNT; v++)
+        bump(v);
+}
+
+// Setters take effect after apply_ticks updates, like a server round trip
+static void defer(const std::function<void()>& apply, unsigned long delay)
+{
+    if (0 == delay)
+    {   apply();
+        return;
+    }
+    FakePending pending = {Fake.ticks + delay, apply};
+    Fake.pending.push_back(pending);
+}
+
+static void defer(const std::function<void()>& apply)
+{
+    defer(apply, Fake.config.apply_ticks);
+}
+
+static FakeRadio* find_radio(int index)
+{
+    return ((index >= 0) && (index < (int)Fake.radios.size())) ? &Fake.radios[index] : NULL;
+}
+
+static const FakeNet* find_net(int radio_index, int net_index)
+{
+    FakeRadio* radio = find_radio(radio_index);
+    if (!radio || (net_index < 0) || (net_index >= (int)radio->nets.size()))
+        return NULL;
+    return &Fake.plan[radio->nets[net_index]];
+}
+
+static const FakeNet* active_net(int radio_index)
+{
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? find_net(radio_index, radio->active) : NULL;
+}
+
+static FakeJammer* find_jammer(int index)
+{
+    return ((index >= 0) && (index < (int)Fake.jammers.size())) ? &Fake.jammers[index] : NULL;
+}
+
+static const FakeNet* find_jammer_net(int jammer_index, int net_index)
+{
+    FakeJammer* jammer = find_jammer(jammer_index);
+    if (!jammer || (net_index < 0) || (net_index >= (int)jammer->nets.size()))
+        return NULL;
+    return &Fake.plan[jammer->nets[net_index]];
+}
+
+static FakeCall* find_call(const char* call_id)
+{
+    for (size_t i = 0; i < Fake.calls.size(); i++)
+    {   if (Fake.calls[i].id == call_id)
+            return &Fake.calls[i];
+    }
+    return NULL;
+}
+
+static FakeEndpoint* find_endpoint(FakeCall* call, const char* endpoint_id)
+{
+    for (size_t i = 0; call && (i < call->endpoints.size()); i++)
+    {   if (call->endpoints[i].id == endpoint_id)
+            return &call->endpoints[i];
+    }
+    return NULL;
+}
+
+static const char* named_name(const std::vector<FakeNamed>& list, const char* id)
+{
+    for (size_t i = 0; i < list.size(); i++)
+    {   if (list[i].id == id)
+            return list[i].name.c_str();
+    }
+    return "";
+}
+
+static const char* named_next(const std::vector<FakeNamed>& list, size_t& cursor)
+{
+    return (cursor < list.size()) ? list[cursor++].id.c_str() : "";
+}
+
+static void tune(FakeRadio& radio, int net)
+{
+    radio.active = net;
+    const FakeNet& plan_net = Fake.plan[radio.nets[net]];
+    radio.rx_frequency = plan_net.frequency;
+    radio.tx_frequency = plan_net.frequency;
+    radio.crypto_system = plan_net.crypto_system;
+    radio.crypto_key = plan_net.crypto_key;
+}
+
+static void build_server(void)
+{
+    static const char* waveforms[] = {"AM", "FM", "SINCGARS", "HAVEQUICK", "SATCOM"};
+    static const int tuning[] = {RADIO_TUNE_FREQ_BW, RADIO_TUNE_FREQ, RADIO_TUNE_SG,
+                                 RADIO_TUNE_HQ, RADIO_TUNE_FREQ};
+    const FakeVrccConfig_t& config = Fake.config;
+    char name[64];
+
+    Fake.plan.resize(config.plan_nets > 0 ? config.plan_nets : 1);
+    for (int p = 0; p < (int)Fake.plan.size(); p++)
+    {   FakeNet& net = Fake.plan[p];
+        snprintf(name, sizeof(name), "Net %d", p);
+        net.id = make_id(ID_NET, p);
+        net.name = name;
+        net.waveform = waveforms[p % 5];
+        net.frequency = 30000000ULL + 25000ULL * p;
+        net.crypto_enabled = (0 == p % 3);
+        net.crypto_system = 1 + p % 4;
+        net.crypto_key = 1 + p % 16;
+        net.freq_hop_id = (2 == p % 5) ? p : 0;
+        net.satcom_channel = (4 == p % 5) ? p % 32 : 0;
+        net.tuning_method = tuning[p % 5];
+    }
+
+    Fake.roles.resize(config.roles);
+    for (int i = 0; i < config.roles; i++)
+    {   snprintf(name, sizeof(name), "Role %d", i);
+        Fake.roles[i].id = make_id(ID_ROLE, i);
+        Fake.roles[i].name = name;
+    }
+    Fake.entity_states.resize(4);
+    Fake.radio_effects.resize(3);
+    Fake.playsounds.resize(3);
+    Fake.clouds.resize(2);
+    for (int i = 0; i < 4; i++)
+    {   snprintf(name, sizeof(name), "Entity State %d", i);
+        Fake.entity_states[i].id = make_id(ID_ENTITYSTATE, i);
+        Fake.entity_states[i].name = name;
+    }
+    for (int i = 0; i < 3; i++)
+    {   snprintf(name, sizeof(name), "Effects %d", i);
+        Fake.radio_effects[i].id = make_id(ID_RADIOEFFECTS, i);
+        Fake.radio_effects[i].name = name;
+        snprintf(name, sizeof(name), "Playsound %d", i);
+        Fake.playsounds[i].id = make_id(ID_PLAYSOUND, i);
+        Fake.playsounds[i].name = name;
+    }
+    for (int i = 0; i < 2; i++)
+    {   snprintf(name, sizeof(name), "cloud-%d", i);
+        Fake.clouds[i].id = make_id(ID_CLOUD, i);
+        Fake.clouds[i].name = name;
+    }
+    for (int t = AUDIO_DEVICE_PLAYBACK; t < AUDIO_DEVICE_TOTAL; t++)
+    {   Fake.devices[t].resize(2);
+        for (int i = 0; i < 2; i++)
+        {   snprintf(name, sizeof(name), "Audio Device %d.%d", t, i);
+            Fake.devices[t][i].id = make_id(ID_AUDIODEVICE, t * 16 + i);
+            Fake.devices[t][i].name = name;
+        }
+        Fake.device_active[t] = Fake.devices[t][0].id;
+    }
+}
+
+static void connect_server(const char* ip)
+{
+    const FakeVrccConfig_t& config = Fake.config;
+    char value[64];
+    Fake.target_ip = ip;
+    Fake.connection_status = STATUS_CONNECTED;
+    Fake.connection_mode = CONNECT_MODE_SERVER;
+    Fake.connect_state = ROLES_RECEIVED;
+
+    Fake.operators.resize(config.operators);
+    for (int i = 0; i < config.operators; i++)
+    {   FakeOperator& op = Fake.operators[i];
+        op.id = make_id(ID_OPERATOR, i);
+        op.fields["role"] = config.roles ? Fake.roles[i % config.roles].name : "";
+        snprintf(value, sizeof(value), "client-%d", i);
+        op.fields["clientname"] = value;
+        snprintf(value, sizeof(value), "voisus-%d", i % 4);
+        op.fields["hostname"] = value;
+        op.fields["connected"] = (4 == i % 5) ? "false" : "true";
+        op.fields["callactive"] = (0 == i % 3) ? "true" : "false";
+        op.fields["clientversion"] = "5.13.0";
+        op.fields["serverversion"] = "5.13.0";
+    }
+    bump_all();
+}
+
+static void connect_role(int role)
+{
+    const FakeVrccConfig_t& config = Fake.config;
+    char name[64];
+    Fake.role_active = role;
+    Fake.connect_state = ROLE_CONNECTED;
+    Fake.endpoint_id = make_id(ID_ENDPOINT, 0);
+
+    Fake.radios.resize(config.radios);
+    for (int r = 0; r < config.radios; r++)
+    {   FakeRadio& radio = Fake.radios[r];
+        snprintf(name, sizeof(name), "Radio %d", r);
+        radio.name = name;
+        radio.effects = Fake.radio_effects[0].id;
+        radio.playsound = "";
+        radio.nets.resize(config.nets_per_radio > 0 ? config.nets_per_radio : 1);
+        for (int n = 0; n < (int)radio.nets.size(); n++)
+            radio.nets[n] = (r * 13 + n) % Fake.plan.size();
+        tune(radio, 0);
+        radio.crypto_enable = 1;
+        radio.rx_enabled = 1;
+        radio.tx_enabled = (0 == r % 2);
+        radio.receiving = 0;
+        radio.transmitting = 0;
+        radio.volume = 75.0f;
+        radio.volume_left = 75.0f;
+        radio.volume_right = 75.0f;
+        radio.balance = BALANCE_CENTER;
+        radio.ptt = 0;
+        radio.level_enabled = 0;
+        radio.level = 0.0f;
+    }
+
+    Fake.jammers.resize(config.jammers);
+    for (int j = 0; j < config.jammers; j++)
+    {   FakeJammer& jammer = Fake.jammers[j];
+        jammer.nets.resize(config.nets_per_jammer > 0 ? config.nets_per_jammer : 1);
+        for (int n = 0; n < (int)jammer.nets.size(); n++)
+            jammer.nets[n] = (j * 5 + n) % Fake.plan.size();
+        jammer.active = 0;
+        jammer.enabled = 0;
+        jammer.state = JAMMER_STATE_INIT;
+        jammer.progress = 0;
+        jammer.duration_ms = 0;
+        jammer.loop = 0;
+    }
+
+    Fake.calls.clear();
+    for (int c = 0; c < config.calls; c++)
+    {   FakeCall call;
+        call.id = make_id(ID_CALL, Fake.next_call++);
+        FakeEndpoint self = {Fake.endpoint_id, CALL_STATE_CONNECTED, 0};
+        call.endpoints.push_back(self);
+        for (int e = 1; (e < config.endpoints_per_call) && config.operators; e++)
+        {   FakeEndpoint ep = {Fake.operators[(c * 7 + e) % config.operators].id,
+                               CALL_STATE_CONNECTED, 0};
+            call.endpoints.push_back(ep);
+        }
+        Fake.calls.push_back(call);
+    }
+    bump_all();
+}
+
+static void disconnect_server(void)
+{
+    Fake.connection_status = STATUS_DISCONNECTED;
+    Fake.connect_state = TARGET_CONNECT;
+    Fake.role_active = -1;
+    Fake.endpoint_id = "";
+    Fake.radios.clear();
+    Fake.jammers.clear();
+    Fake.operators.clear();
+    Fake.calls.clear();
+    Fake.invitations.clear();
+    Fake.invitation_ids.clear();
+    Fake.pending.clear();
+    bump_all();
+}
+
+static void update_jammers(void)
+{
+    double now = now_ms();
+    for (size_t j = 0; j < Fake.jammers.size(); j++)
+    {   FakeJammer& jammer = Fake.jammers[j];
+        int state = jammer.state;
+        int progress = jammer.progress;
+        double elapsed = now - jammer.start_ms;
+        switch (jammer.state)
+        {   case JAMMER_STATE_WAITING:
+                // Audio is always heard on the next update
+                jammer.state = JAMMER_STATE_RECORDING;
+                jammer.start_ms = now;
+                jammer.progress = 0;
+                break;
+            case JAMMER_STATE_RECORDING:
+                if (elapsed >= jammer.length_ms)
+                {   jammer.state = JAMMER_STATE_IDLE;
+                    jammer.duration_ms = (int)jammer.length_ms;
+                    jammer.progress = 100;
+                }
+                else
+                    jammer.progress = (int)(100.0 * elapsed / jammer.length_ms);
+                break;
+            case JAMMER_STATE_REPLAYING:
+                if (jammer.loop)
+                {   long long duration = jammer.duration_ms ? jammer.duration_ms : 1;
+                    jammer.progress = (int)(100 * ((long long)elapsed % duration) / duration);
+                }
+                else if (elapsed >= jammer.duration_ms)
+                {   jammer.state = JAMMER_STATE_IDLE;
+                    jammer.progress = 100;
+                }
+                else
+                    jammer.progress = (int)(100.0 * elapsed / jammer.duration_ms);
+                break;
+            default:
+                break;
+        }
+        if ((state != jammer.state) || (progress != jammer.progress))
+            bump(V_JAMMER);
+    }
+}
+
+static void update_calls(void)
+{
+    for (size_t c = 0; c < Fake.calls.size(); c++)
+    {   std::vector<FakeEndpoint>& endpoints = Fake.calls[c].endpoints;
+        for (size_t e = 0; e < endpoints.size(); e++)
+        {   if ((CALL_STATE_SIGNALING == endpoints[e].state) &&
+                (endpoints[e].id != Fake.endpoint_id) &&
+                (Fake.ticks >= endpoints[e].answer_tick))
+            {   endpoints[e].state = CALL_STATE_CONNECTED;
+                bump(V_CALL);
+            }
+        }
+    }
+}
+
+static void update_ptt(void)
+{
+    for (int p = 0; p < MAX_PTT; p++)
+    {   if (Fake.ptt[p] == Fake.ptt_applied[p])
+            continue;
+        Fake.ptt_applied[p] = Fake.ptt[p];
+        for (size_t r = 0; r < Fake.radios.size(); r++)
+        {   FakeRadio& radio = Fake.radios[r];
+            if ((radio.ptt == p) && radio.tx_enabled)
+                radio.transmitting = Fake.ptt[p];
+        }
+        bump(V_RADIO);
+    }
+}
+
+static void update_activity(void)
+{
+    for (size_t r = 0; r < Fake.radios.size(); r++)
+    {   FakeRadio& radio = Fake.radios[r];
+        if (Fake.config.activity_permille &&
+            ((int)(fake_rand() % 1000) < Fake.config.activity_permille))
+        {   radio.receiving = radio.rx_enabled && !radio.receiving;
+            bump(V_RADIO);
+        }
+        if (radio.receiving && radio.level_enabled)
+            radio.level = 0.1f + 0.9f * (fake_rand() % 1000) / 1000.0f;
+        else if (!radio.receiving)
+            radio.level = 0.0f;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Scripted events
+///////////////////////////////////////////////////////////////////////////////
+
+static int set_flag(int current, const std::string& value)
+{
+    return ("toggle" == value) ? !current : atoi(value.c_str());
+}
+
+static void for_targets(const std::string& target, size_t count,
+                        const std::function<void(size_t)>& func)
+{
+    if ("*" == target)
+    {   for (size_t i = 0; i < count; i++)
+            func(i);
+    }
+    else if ((size_t)atoi(target.c_str()) < count)
+        func(atoi(target.c_str()));
+}
+
+static void run_event(const FakeEvent& ev)
+{
+    const std::string& a0 = ev.args[0];
+    const std::string& a1 = ev.args[1];
+    if ("rx" == ev.action)
+        for_targets(a0, Fake.radios.size(), [&](size_t r) {
+            Fake.radios[r].receiving = set_flag(Fake.radios[r].receiving, a1);
+            bump(V_RADIO);
+        });
+    else if ("tx" == ev.action)
+        for_targets(a0, Fake.radios.size(), [&](size_t r) {
+            Fake.radios[r].transmitting = set_flag(Fake.radios[r].transmitting, a1);
+            bump(V_RADIO);
+        });
+    else if ("level" == ev.action)
+        for_targets(a0, Fake.radios.size(), [&](size_t r) {
+            Fake.radios[r].level = (float)atof(a1.c_str());
+        });
+    else if ("net" == ev.action)
+        for_targets(a0, Fake.radios.size(), [&](size_t r) {
+            int net = atoi(a1.c_str());
+            if (net < (int)Fake.radios[r].nets.size())
+            {   tune(Fake.radios[r], net);
+                bump(V_RADIO);
+            }
+        });
+    else if ("jammer_state" == ev.action)
+        for_targets(a0, Fake.jammers.size(), [&](size_t j) {
+            Fake.jammers[j].state = atoi(a1.c_str());
+            Fake.jammers[j].start_ms = now_ms();
+            bump(V_JAMMER);
+        });
+    else if ("jammer_progress" == ev.action)
+        for_targets(a0, Fake.jammers.size(), [&](size_t j) {
+            Fake.jammers[j].progress = atoi(a1.c_str());
+            bump(V_JAMMER);
+        });
+    else if ("operator" == ev.action)
+        for_targets(a0, Fake.operators.size(), [&](size_t o) {
+            Fake.operators[o].fields[a1] = ev.args[2];
+            bump(V_OPERATOR);
+        });
+    else if ("invite" == ev.action)
+        for_targets(a0, Fake.operators.size(), [&](size_t o) {
+            FakeCall call;
+            call.id = make_id(ID_CALL, Fake.next_call++);
+            FakeEndpoint inviter = {Fake.operators[o].id, CALL_STATE_CONNECTED, 0};
+            FakeEndpoint self = {Fake.endpoint_id, CALL_STATE_SIGNALING, 0};
+            call.endpoints.push_back(inviter);
+            call.endpoints.push_back(self);
+            Fake.calls.push_back(call);
+            Fake.invitation_ids.push_back(call.id);
+            Fake.invitation_ids.push_back(inviter.id);
+            bump(V_CALL);
+            bump(V_INVITATION);
+        });
+    else if ("bump" == ev.action)
+    {   for (int v = 0; v < V_COUNT; v++)
+        {   if (a0 == Version_names[v])
+                bump(v);
+        }
+    }
+    else if ("disconnect" == ev.action)
+        disconnect_server();
+}
+
+static void run_events(void)
+{
+    for (size_t i = 0; i < Fake.events.size(); i++)
+    {   const FakeEvent& ev = Fake.events[i];
+        if (ev.every ? ((Fake.ticks >= ev.tick) && (0 == (Fake.ticks - ev.tick) % ev.every))
+                     : (Fake.ticks == ev.tick))
+            run_event(ev);
+    }
+}
+
+static void load_script(const char* path)
+{
+    FILE* fp = fopen(path, "r");
+    if (!fp)
+    {   perror(path);
+        return;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), fp))
+    {   if (!FakeVrcc_Script(line))
+            fprintf(stderr, "vrcc-fake: bad script line: %s", line);
+    }
+    fclose(fp);
+}
+
+static void load_latencies(const char* spec)
+{
+    std::string all = spec;
+    size_t pos = 0;
+    while (pos < all.size())
+    {   size_t end = all.find(',', pos);
+        std::string item = all.substr(pos, (end == std::string::npos) ? std::string::npos : end - pos);
+        size_t eq = item.find('=');
+        if (eq != std::string::npos)
+            FakeVrcc_SetLatency(item.substr(0, eq).c_str(), atoi(item.c_str() + eq + 1));
+        if (end == std::string::npos)
+            break;
+        pos = end + 1;
+    }
+}
+
+static void reset_state(void)
+{
+    FakeVrccConfig_t config = Fake.config;
+    int configured = Fake.configured;
+    Fake = FakeState();
+    Fake.config = config;
+    Fake.configured = configured;
+    Fake.role_active = -1;
+    Fake.role_set = -1;
+    Fake.entity_state_set = -1;
+    Fake.entity_state_active = -1;
+    Fake.connection_status = STATUS_NONE;
+    Fake.connect_state = TARGET_CONNECT;
+    Fake.vox_threshold = 0.1f;
+    Fake.earphone_volume = 75.0f;
+    Fake.mic_volume = 75.0f;
+    Fake.sidetone_volume = 25.0f;
+    Fake.phone_volume = 75.0f;
+    Fake.next_license = 1;
+    Fake.rng = config.seed;
+    Fake.start = std::chrono::steady_clock::now();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Control interface
+///////////////////////////////////////////////////////////////////////////////
+
+void FakeVrcc_DefaultConfig(FakeVrccConfig_t* config)
+{
+    config->radios = env_int("VRCC_FAKE_RADIOS", 8);
+    config->nets_per_radio = env_int("VRCC_FAKE_NETS", 4);
+    config->plan_nets = env_int("VRCC_FAKE_PLAN_NETS", config->nets_per_radio * 4);
+    config->jammers = env_int("VRCC_FAKE_JAMMERS", 2);
+    config->nets_per_jammer = env_int("VRCC_FAKE_JAMMER_NETS", 4);
+    config->roles = env_int("VRCC_FAKE_ROLES", 4);
+    config->operators = env_int("VRCC_FAKE_OPERATORS", 8);
+    config->calls = env_int("VRCC_FAKE_CALLS", 0);
+    config->endpoints_per_call = env_int("VRCC_FAKE_CALL_ENDPOINTS", 3);
+    config->connected = env_int("VRCC_FAKE_CONNECTED", 0);
+    config->tick_ms = env_int("VRCC_FAKE_TICK_MS", 0);
+    config->apply_ticks = env_int("VRCC_FAKE_APPLY_TICKS", 1);
+    config->answer_ticks = env_int("VRCC_FAKE_ANSWER_TICKS", 3);
+    config->activity_permille = env_int("VRCC_FAKE_ACTIVITY", 0);
+    config->seed = env_int("VRCC_FAKE_SEED", 1);
+}
+
+void FakeVrcc_Configure(const FakeVrccConfig_t* config)
+{
+    Fake.config = *config;
+    Fake.configured = 1;
+    reset_state();
+    // Slots are cached by FAKE_ENTRY, so only their values are cleared
+    for (size_t i = 0; i < Latencies.size(); i++)
+        Latencies[i] = -1;
+    Default_latency = 0;
+}
+
+void FakeVrcc_SetLatency(const char* function, unsigned int usec)
+{
+    if (0 == strcmp(function, "*"))
+        Default_latency = usec;
+    else
+        Latencies[latency_slot(function)] = usec;
+}
+
+int FakeVrcc_Script(const char* line)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s", line);
+    char* tokens[6] = {NULL};
+    int count = 0;
+    for (char* tok = strtok(buf, " \t\r\n"); tok && (count < 6); tok = strtok(NULL, " \t\r\n"))
+        tokens[count++] = tok;
+    if ((0 == count) || ('#' == tokens[0][0]))
+        return 1;
+    FakeEvent ev;
+    int first = 1;
+    ev.every = 0;
+    if (0 == strcmp(tokens[0], "every"))
+    {   if (count < 3)
+            return 0;
+        ev.every = strtoul(tokens[1], NULL, 10);
+        ev.tick = ev.every;
+        first = 2;
+    }
+    else
+        ev.tick = strtoul(tokens[0], NULL, 10);
+    if ((first >= count) || ((0 == ev.tick) && (0 == ev.every)))
+        return 0;
+    ev.action = tokens[first];
+    for (int i = 0; (i < 3) && (first + 1 + i < count); i++)
+        ev.args[i] = tokens[first + 1 + i];
+    Fake.events.push_back(ev);
+    return 1;
+}
+
+unsigned long FakeVrcc_Ticks(void)
+{
+    return Fake.ticks;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// VRCC
+///////////////////////////////////////////////////////////////////////////////
+
+int VRCC_Start(int argc, char* argv[])
+{
+    FAKE_ENTRY();
+    (void)argc;
+    (void)argv;
+    if (!Fake.configured)
+    {   FakeVrccConfig_t config;
+        FakeVrcc_DefaultConfig(&config);
+        Fake.config = config;
+        reset_state();
+        if (getenv("VRCC_FAKE_LATENCY"))
+            load_latencies(getenv("VRCC_FAKE_LATENCY"));
+        if (getenv("VRCC_FAKE_SCRIPT"))
+            load_script(getenv("VRCC_FAKE_SCRIPT"));
+    }
+    Fake.start = std::chrono::steady_clock::now();
+    build_server();
+    if (Fake.config.connected)
+    {   connect_server("127.0.0.1");
+        connect_role(0);
+    }
+    return 1;
+}
+
+void VRCC_Shutdown()
+{
+    FAKE_ENTRY();
+    Fake.pending.clear();
+}
+
+int VRCC_Update(void)
+{
+    FAKE_ENTRY();
+    Fake.ticks++;
+    Fake.changed = 0;
+
+    // Pending setters may queue more, so apply from a copy
+    std::vector<FakePending> due;
+    for (size_t i = 0; i < Fake.pending.size();)
+    {   if (Fake.pending[i].tick <= Fake.ticks)
+        {   due.push_back(Fake.pending[i]);
+            Fake.pending.erase(Fake.pending.begin() + i);
+        }
+        else
+            i++;
+    }
+    for (size_t i = 0; i < due.size(); i++)
+        due[i].apply();
+
+    update_ptt();
+    update_jammers();
+    update_calls();
+    update_activity();
+    run_events();
+    return Fake.changed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Voisus
+///////////////////////////////////////////////////////////////////////////////
+
+void Voisus_ConnectServer(const char* target_ip)
+{
+    FAKE_ENTRY();
+    if (STATUS_CONNECTED == Fake.connection_status)
+        disconnect_server();
+    connect_server(target_ip);
+    if (Fake.role_set >= 0)
+        connect_role(Fake.role_set);
+}
+
+void Voisus_Disconnect()
+{
+    FAKE_ENTRY();
+    disconnect_server();
+}
+
+int Voisus_Error()
+{
+    FAKE_ENTRY();
+    return ERROR_OFF;
+}
+
+void Voisus_Save()
+{
+    FAKE_ENTRY();
+}
+
+const char* Voisus_LogPath()
+{
+    FAKE_ENTRY();
+    return "";
+}
+
+const char* Voisus_ClientBuildVersion()
+{
+    FAKE_ENTRY();
+    return "fake-5.13.0";
+}
+
+const char* Voisus_ClientMsgVersion()
+{
+    FAKE_ENTRY();
+    return "fake-5.13.0";
+}
+
+const char* Voisus_ClientMsgDate()
+{
+    FAKE_ENTRY();
+    return "2017-01-01";
+}
+
+const char* Voisus_ServerBuildVersion()
+{
+    FAKE_ENTRY();
+    return (STATUS_CONNECTED == Fake.connection_status) ? "fake-5.13.0" : "";
+}
+
+const char* Voisus_ServerMsgVersion()
+{
+    FAKE_ENTRY();
+    return (STATUS_CONNECTED == Fake.connection_status) ? "fake-5.13.0" : "";
+}
+
+const char* Voisus_ServerMsgDate()
+{
+    FAKE_ENTRY();
+    return (STATUS_CONNECTED == Fake.connection_status) ? "2017-01-01" : "";
+}
+
+void Voisus_MonitorPowerEvents(int hwnd)
+{
+    FAKE_ENTRY();
+    (void)hwnd;
+}
+
+void Voisus_SetServerMasterVolume(float volume)
+{
+    FAKE_ENTRY();
+    (void)volume;
+}
+
+void Voisus_SetServerSidetoneVolume(float volume)
+{
+    FAKE_ENTRY();
+    (void)volume;
+}
+
+void Voisus_ConnectCloud(const char* cloud_id)
+{
+    FAKE_ENTRY();
+    Fake.cloud_set = cloud_id;
+    Fake.cloud_active = cloud_id;
+    connect_server("127.0.0.1");
+    Fake.connection_mode = CONNECT_MODE_CLOUD;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Network
+///////////////////////////////////////////////////////////////////////////////
+
+const char* Network_TargetIP()
+{
+    FAKE_ENTRY();
+    return Fake.target_ip.c_str();
+}
+
+const char* Network_ClientIP()
+{
+    FAKE_ENTRY();
+    return (STATUS_CONNECTED == Fake.connection_status) ? "127.0.0.1" : "";
+}
+
+int Network_ConnectionStatus()
+{
+    FAKE_ENTRY();
+    return Fake.connection_status;
+}
+
+int Network_ConnectState()
+{
+    FAKE_ENTRY();
+    return Fake.connect_state;
+}
+
+const char* Network_ClientName()
+{
+    FAKE_ENTRY();
+    return Fake.client_name.c_str();
+}
+
+void Network_SetClientName(const char* name)
+{
+    FAKE_ENTRY();
+    Fake.client_name = name;
+}
+
+const char* Network_OperatorId()
+{
+    FAKE_ENTRY();
+    return Fake.endpoint_id.c_str();
+}
+
+const char* Network_CloudSet()
+{
+    FAKE_ENTRY();
+    return Fake.cloud_set.c_str();
+}
+
+const char* Network_CloudActive()
+{
+    FAKE_ENTRY();
+    return Fake.cloud_active.c_str();
+}
+
+int Network_ConnectionMode()
+{
+    FAKE_ENTRY();
+    return Fake.connection_mode;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Role
+///////////////////////////////////////////////////////////////////////////////
+
+static const FakeNamed* find_role(int index)
+{
+    return ((index >= 0) && (index < (int)Fake.roles.size())) ? &Fake.roles[index] : NULL;
+}
+
+static int role_index(const char* role_id)
+{
+    for (size_t i = 0; i < Fake.roles.size(); i++)
+    {   if (Fake.roles[i].id == role_id)
+            return (int)i;
+    }
+    return -1;
+}
+
+int Role_ListCount()
+{
+    FAKE_ENTRY();
+    return (Fake.connect_state >= ROLES_RECEIVED) ? (int)Fake.roles.size() : 0;
+}
+
+int Role_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_ROLE];
+}
+
+const char* Role_Name(int list_index)
+{
+    FAKE_ENTRY();
+    const FakeNamed* role = find_role(list_index);
+    return role ? role->name.c_str() : "";
+}
+
+const char* Role_Id(int list_index)
+{
+    FAKE_ENTRY();
+    const FakeNamed* role = find_role(list_index);
+    return role ? role->id.c_str() : "";
+}
+
+const char* Role_NameActive()
+{
+    FAKE_ENTRY();
+    const FakeNamed* role = find_role(Fake.role_active);
+    return role ? role->name.c_str() : "";
+}
+
+const char* Role_IdActive()
+{
+    FAKE_ENTRY();
+    const FakeNamed* role = find_role(Fake.role_active);
+    return role ? role->id.c_str() : "";
+}
+
+const char* Role_NameSet()
+{
+    FAKE_ENTRY();
+    const FakeNamed* role = find_role(Fake.role_set);
+    return role ? role->name.c_str() : "";
+}
+
+const char* Role_IdSet()
+{
+    FAKE_ENTRY();
+    const FakeNamed* role = find_role(Fake.role_set);
+    return role ? role->id.c_str() : "";
+}
+
+int Role_AutotuneEnabled(const char* role_id)
+{
+    FAKE_ENTRY();
+    return role_index(role_id) >= 0;
+}
+
+int Role_RadCtrlEnabled(const char* role_id)
+{
+    FAKE_ENTRY();
+    (void)role_id;
+    return 0;
+}
+
+void Role_SetRole(const char* role_id)
+{
+    FAKE_ENTRY();
+    int role = role_index(role_id);
+    if (role < 0)
+        return;
+    Fake.role_set = role;
+    if (Fake.connect_state < ROLES_RECEIVED)
+        return;
+    Fake.connect_state = ROLE_SET;
+    Fake.changed = 1;
+    defer([] { Fake.connect_state = ROLE_CONNECT; Fake.changed = 1; });
+    defer([role] { connect_role(role); }, Fake.config.apply_ticks + 1);
+}
+
+int Role_CallingEnabled(const char* role_id)
+{
+    FAKE_ENTRY();
+    return role_index(role_id) >= 0;
+}
+
+int Role_CallPTTEnabled(const char* role_id)
+{
+    FAKE_ENTRY();
+    (void)role_id;
+    return 0;
+}
+
+int Role_ChatEnabled(const char* role_id)
+{
+    FAKE_ENTRY();
+    return role_index(role_id) >= 0;
+}
+
+int Role_ChannelDisplayMap(const char* role_id, int index)
+{
+    FAKE_ENTRY();
+    (void)role_id;
+    return index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// EntityState
+///////////////////////////////////////////////////////////////////////////////
+
+static const FakeNamed* find_entity_state(int index)
+{
+    return ((index >= 0) && (index < (int)Fake.entity_states.size())) ? &Fake.entity_states[index] : NULL;
+}
+
+int EntityState_ListCount()
+{
+    FAKE_ENTRY();
+    return (int)Fake.entity_states.size();
+}
+
+int EntityState_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_ENTITYSTATE];
+}
+
+const char* EntityState_Name(int list_index)
+{
+    FAKE_ENTRY();
+    const FakeNamed* state = find_entity_state(list_index);
+    return state ? state->name.c_str() : "";
+}
+
+const char* EntityState_Id(int list_index)
+{
+    FAKE_ENTRY();
+    const FakeNamed* state = find_entity_state(list_index);
+    return state ? state->id.c_str() : "";
+}
+
+const char* EntityState_NameActive()
+{
+    FAKE_ENTRY();
+    const FakeNamed* state = find_entity_state(Fake.entity_state_active);
+    return state ? state->name.c_str() : "";
+}
+
+const char* EntityState_IdActive()
+{
+    FAKE_ENTRY();
+    const FakeNamed* state = find_entity_state(Fake.entity_state_active);
+    return state ? state->id.c_str() : "";
+}
+
+const char* EntityState_NameSet()
+{
+    FAKE_ENTRY();
+    const FakeNamed* state = find_entity_state(Fake.entity_state_set);
+    return state ? state->name.c_str() : "";
+}
+
+const char* EntityState_IdSet()
+{
+    FAKE_ENTRY();
+    const FakeNamed* state = find_entity_state(Fake.entity_state_set);
+    return state ? state->id.c_str() : "";
+}
+
+void EntityState_SetEntityState(const char* id)
+{
+    FAKE_ENTRY();
+    for (size_t i = 0; i < Fake.entity_states.size(); i++)
+    {   if (Fake.entity_states[i].id == id)
+        {   int state = (int)i;
+            Fake.entity_state_set = state;
+            defer([state] { Fake.entity_state_active = state; bump(V_ENTITYSTATE); });
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Headset
+///////////////////////////////////////////////////////////////////////////////
+
+float Headset_VoxThreshold()
+{
+    FAKE_ENTRY();
+    return Fake.vox_threshold;
+}
+
+int Headset_MicrophoneMode()
+{
+    FAKE_ENTRY();
+    return Fake.mic_mode;
+}
+
+float Headset_EarphoneVolume()
+{
+    FAKE_ENTRY();
+    return Fake.earphone_volume;
+}
+
+float Headset_MicVolume()
+{
+    FAKE_ENTRY();
+    return Fake.mic_volume;
+}
+
+float Headset_SidetoneVolume()
+{
+    FAKE_ENTRY();
+    return Fake.sidetone_volume;
+}
+
+int Headset_HasSidetone()
+{
+    FAKE_ENTRY();
+    return 1;
+}
+
+void Headset_SetHeadsetPreset(int preset)
+{
+    FAKE_ENTRY();
+    (void)preset;
+}
+
+void Headset_SetVoxThreshold(float threshold)
+{
+    FAKE_ENTRY();
+    Fake.vox_threshold = threshold;
+}
+
+void Headset_SetMicrophoneMode(int mode)
+{
+    FAKE_ENTRY();
+    Fake.mic_mode = mode;
+}
+
+void Headset_SetCallMicrophoneMute(int active)
+{
+    FAKE_ENTRY();
+    (void)active;
+}
+
+void Headset_SetEarphoneVolume(float volume)
+{
+    FAKE_ENTRY();
+    Fake.earphone_volume = volume;
+}
+
+void Headset_SetMicVolume(float volume)
+{
+    FAKE_ENTRY();
+    Fake.mic_volume = volume;
+}
+
+void Headset_SetSidetoneVolume(float volume)
+{
+    FAKE_ENTRY();
+    Fake.sidetone_volume = volume;
+}
+
+int Headset_DeviceConfigured()
+{
+    FAKE_ENTRY();
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// PTT
+///////////////////////////////////////////////////////////////////////////////
+
+void PTT_SetPressed_Multi(int ptt, int pressed)
+{
+    FAKE_ENTRY();
+    if ((ptt >= 0) && (ptt < MAX_PTT))
+        Fake.ptt[ptt] = pressed ? 1 : 0;
+}
+
+void PTT_SetPressed(int pressed)
+{
+    FAKE_ENTRY();
+    Fake.ptt[0] = pressed ? 1 : 0;
+}
+
+int PTT_GetPressed_Multi(int ptt)
+{
+    FAKE_ENTRY();
+    return ((ptt >= 0) && (ptt < MAX_PTT)) ? Fake.ptt[ptt] : 0;
+}
+
+int PTT_GetPressed()
+{
+    FAKE_ENTRY();
+    return Fake.ptt[0];
+}
+
+int PTT_HWGetPressed_Multi(int ptt)
+{
+    FAKE_ENTRY();
+    (void)ptt;
+    return 0;
+}
+
+int PTT_HWGetPressed()
+{
+    FAKE_ENTRY();
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Radio
+///////////////////////////////////////////////////////////////////////////////
+
+int Radio_ListCount()
+{
+    FAKE_ENTRY();
+    return (int)Fake.radios.size();
+}
+
+const char* Radio_Name(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->name.c_str() : "";
+}
+
+void Radio_SetNet(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    defer([radio_index, net_index] {
+        FakeRadio* radio = find_radio(radio_index);
+        if (radio && (net_index >= 0) && (net_index < (int)radio->nets.size()))
+        {   tune(*radio, net_index);
+            bump(V_RADIO);
+        }
+    });
+}
+
+void Radio_SetNetRxFrequency(int radio_index, const char* net_id, unsigned long long freq)
+{
+    FAKE_ENTRY();
+    std::string id = net_id;
+    defer([radio_index, id, freq] {
+        const FakeNet* net = active_net(radio_index);
+        if (net && (net->id == id))
+        {   find_radio(radio_index)->rx_frequency = freq;
+            bump(V_RADIO);
+        }
+    });
+}
+
+unsigned long long Radio_NetRxFrequencyActive(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->rx_frequency : 0;
+}
+
+void Radio_SetNetTxFrequency(int radio_index, const char* net_id, unsigned long long freq)
+{
+    FAKE_ENTRY();
+    std::string id = net_id;
+    defer([radio_index, id, freq] {
+        const FakeNet* net = active_net(radio_index);
+        if (net && (net->id == id))
+        {   find_radio(radio_index)->tx_frequency = freq;
+            bump(V_RADIO);
+        }
+    });
+}
+
+unsigned long long Radio_NetTxFrequencyActive(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->tx_frequency : 0;
+}
+
+void Radio_SetNetCrypto(int radio_index, const char* net_id, int system, int key)
+{
+    FAKE_ENTRY();
+    std::string id = net_id;
+    defer([radio_index, id, system, key] {
+        const FakeNet* net = active_net(radio_index);
+        if (net && (net->id == id))
+        {   find_radio(radio_index)->crypto_system = system;
+            find_radio(radio_index)->crypto_key = key;
+            bump(V_RADIO);
+        }
+    });
+}
+
+int Radio_NetCryptoSystemActive(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->crypto_system : 0;
+}
+
+int Radio_NetCryptoKeyActive(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->crypto_key : 0;
+}
+
+int Radio_NetCryptoEnabledActive(int radio_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = active_net(radio_index);
+    return net ? net->crypto_enabled : 0;
+}
+
+const char* Radio_NetWaveformActive(int radio_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = active_net(radio_index);
+    return net ? net->waveform.c_str() : "";
+}
+
+void Radio_SetNetID(int radio_index, const char* net_id)
+{
+    FAKE_ENTRY();
+    std::string id = net_id;
+    defer([radio_index, id] {
+        FakeRadio* radio = find_radio(radio_index);
+        for (size_t n = 0; radio && (n < radio->nets.size()); n++)
+        {   if (Fake.plan[radio->nets[n]].id == id)
+            {   tune(*radio, (int)n);
+                bump(V_RADIO);
+                break;
+            }
+        }
+    });
+}
+
+int Radio_NetListCount(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? (int)radio->nets.size() : 0;
+}
+
+const char* Radio_NetName(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->name.c_str() : "";
+}
+
+const char* Radio_NetNameActive(int radio_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = active_net(radio_index);
+    return net ? net->name.c_str() : "";
+}
+
+const char* Radio_NetID(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->id.c_str() : "";
+}
+
+unsigned long long Radio_NetFrequency(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->frequency : 0;
+}
+
+const char * Radio_NetWaveform(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->waveform.c_str() : "";
+}
+
+int Radio_NetCryptoSystem(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->crypto_system : 0;
+}
+
+int Radio_NetCryptoKey(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->crypto_key : 0;
+}
+
+int Radio_NetCryptoEnabled(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->crypto_enabled : 0;
+}
+
+int Radio_NetFreqHopNetId(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->freq_hop_id : 0;
+}
+
+int Radio_NetSatcomChannel(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->satcom_channel : 0;
+}
+
+int Radio_NetTuningMethod(int radio_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_net(radio_index, net_index);
+    return net ? net->tuning_method : 0;
+}
+
+const char* Radio_NetIDActive(int radio_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = active_net(radio_index);
+    return net ? net->id.c_str() : "";
+}
+
+// Defers a change to one radio field and bumps Radio_Version when applied
+#define DEFER_RADIO(radio_index, field, value) \
+    defer([=] { \
+        FakeRadio* radio = find_radio(radio_index); \
+        if (radio) \
+        {   radio->field = value; \
+            bump(V_RADIO); \
+        } \
+    })
+
+void Radio_SetReceiveEnabled(int radio_index, int enable)
+{
+    FAKE_ENTRY();
+    DEFER_RADIO(radio_index, rx_enabled, enable ? 1 : 0);
+}
+
+void Radio_SetTransmitEnabled(int radio_index, int enable)
+{
+    FAKE_ENTRY();
+    DEFER_RADIO(radio_index, tx_enabled, enable ? 1 : 0);
+}
+
+void Radio_SetCryptoEnable(int radio_index, int enable)
+{
+    FAKE_ENTRY();
+    DEFER_RADIO(radio_index, crypto_enable, enable ? 1 : 0);
+}
+
+void Radio_SetVolume(int radio_index, float volume)
+{
+    FAKE_ENTRY();
+    DEFER_RADIO(radio_index, volume, volume);
+}
+
+void Radio_SetVolumeStereo(int radio_index, float volume_left, float volume_right)
+{
+    FAKE_ENTRY();
+    DEFER_RADIO(radio_index, volume_left, volume_left);
+    DEFER_RADIO(radio_index, volume_right, volume_right);
+}
+
+void Radio_SetBalance(int radio_index, int balance)
+{
+    FAKE_ENTRY();
+    DEFER_RADIO(radio_index, balance, balance);
+}
+
+void Radio_SetPTT(int radio_index, int ptt_index)
+{
+    FAKE_ENTRY();
+    DEFER_RADIO(radio_index, ptt, ptt_index);
+}
+
+void Radio_SetRadioEffects(int radio_index, const char* effects_id)
+{
+    FAKE_ENTRY();
+    std::string id = effects_id;
+    DEFER_RADIO(radio_index, effects, id);
+}
+
+int Radio_IsReceiveEnabled(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->rx_enabled : 0;
+}
+
+int Radio_IsTransmitEnabled(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->tx_enabled : 0;
+}
+
+int Radio_IsReceiving(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->receiving : 0;
+}
+
+int Radio_IsTransmitting(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->transmitting : 0;
+}
+
+int Radio_IsShared(int radio_index)
+{
+    FAKE_ENTRY();
+    (void)radio_index;
+    return 0;
+}
+
+float Radio_Volume(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->volume : 0.0f;
+}
+
+float Radio_VolumeStereoLeft(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->volume_left : 0.0f;
+}
+
+float Radio_VolumeStereoRight(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->volume_right : 0.0f;
+}
+
+int Radio_IsNetLocked(int radio_index)
+{
+    FAKE_ENTRY();
+    (void)radio_index;
+    return 0;
+}
+
+int Radio_IsRXModeLocked(int radio_index)
+{
+    FAKE_ENTRY();
+    (void)radio_index;
+    return 0;
+}
+
+int Radio_IsTXModeLocked(int radio_index)
+{
+    FAKE_ENTRY();
+    (void)radio_index;
+    return 0;
+}
+
+int Radio_Balance(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->balance : 0;
+}
+
+int Radio_BalanceLocked(int radio_index)
+{
+    FAKE_ENTRY();
+    (void)radio_index;
+    return 0;
+}
+
+const char* Radio_Type(int radio_index)
+{
+    FAKE_ENTRY();
+    return find_radio(radio_index) ? "Generic" : "";
+}
+
+int Radio_CryptoEnabled(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->crypto_enable : 0;
+}
+
+int Radio_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_RADIO];
+}
+
+int Radio_PTT(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->ptt : 0;
+}
+
+const char* Radio_RadioEffects(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->effects.c_str() : "";
+}
+
+int Radio_RadioEffectsLocked(int radio_index)
+{
+    FAKE_ENTRY();
+    (void)radio_index;
+    return 0;
+}
+
+const char* Radio_RadCtrlId(int radio_index)
+{
+    FAKE_ENTRY();
+    (void)radio_index;
+    return "";
+}
+
+float Radio_AudioLevel(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return (radio && radio->level_enabled) ? radio->level : 0.0f;
+}
+
+int Radio_AudioLevelEnabled(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->level_enabled : 0;
+}
+
+void Radio_SetAudioLevelEnable(int radio_index, int enable)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    if (radio)
+        radio->level_enabled = enable ? 1 : 0;
+}
+
+void Radio_SetPlaysound(int radio_index, const char* playsound_id)
+{
+    FAKE_ENTRY();
+    std::string id = playsound_id;
+    DEFER_RADIO(radio_index, playsound, id);
+}
+
+const char* Radio_Playsound(int radio_index)
+{
+    FAKE_ENTRY();
+    FakeRadio* radio = find_radio(radio_index);
+    return radio ? radio->playsound.c_str() : "";
+}
+
+int Radio_PlaysoundLocked(int radio_index)
+{
+    FAKE_ENTRY();
+    (void)radio_index;
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Log, Earshot, WorldPosition, Joystick, Codec
+///////////////////////////////////////////////////////////////////////////////
+
+void Log_Write(const char* function, const char* msg)
+{
+    FAKE_ENTRY();
+    (void)function;
+    (void)msg;
+}
+
+void Earshot_Enable(int enable)
+{
+    FAKE_ENTRY();
+    Fake.earshot_enable = enable;
+}
+
+void Earshot_SetPTT(int ptt)
+{
+    FAKE_ENTRY();
+    Fake.earshot_ptt = ptt;
+}
+
+int Earshot_Receiving(void)
+{
+    FAKE_ENTRY();
+    return 0;
+}
+
+int Earshot_Transmitting(void)
+{
+    FAKE_ENTRY();
+    int ptt = Fake.earshot_ptt;
+    return Fake.earshot_enable && (ptt >= 0) && (ptt < MAX_PTT) && Fake.ptt[ptt];
+}
+
+void WorldPosition_Set(float xcoord, float ycoord, float zcoord)
+{
+    FAKE_ENTRY();
+    (void)xcoord;
+    (void)ycoord;
+    (void)zcoord;
+}
+
+int Joystick_ListCount()
+{
+    FAKE_ENTRY();
+    return 0;
+}
+
+const char* Joystick_Name(int list_index)
+{
+    FAKE_ENTRY();
+    (void)list_index;
+    return "";
+}
+
+int Joystick_ButtonCount(int list_index)
+{
+    FAKE_ENTRY();
+    (void)list_index;
+    return 0;
+}
+
+int Joystick_Active_Multi(int ptt)
+{
+    FAKE_ENTRY();
+    (void)ptt;
+    return -1;
+}
+
+int Joystick_Active()
+{
+    FAKE_ENTRY();
+    return -1;
+}
+
+int Joystick_ButtonActive_Multi(int ptt)
+{
+    FAKE_ENTRY();
+    (void)ptt;
+    return -1;
+}
+
+int Joystick_ButtonActive()
+{
+    FAKE_ENTRY();
+    return -1;
+}
+
+int Joystick_Pressed_Multi(int ptt)
+{
+    FAKE_ENTRY();
+    (void)ptt;
+    return 0;
+}
+
+int Joystick_Pressed()
+{
+    FAKE_ENTRY();
+    return 0;
+}
+
+void Joystick_SetButton_Multi(int ptt, int js, int btn)
+{
+    FAKE_ENTRY();
+    (void)ptt;
+    (void)js;
+    (void)btn;
+}
+
+void Joystick_SetButton(int js, int btn)
+{
+    FAKE_ENTRY();
+    (void)js;
+    (void)btn;
+}
+
+int Codec_Get()
+{
+    FAKE_ENTRY();
+    return Fake.codec;
+}
+
+void Codec_Set(int codec)
+{
+    FAKE_ENTRY();
+    Fake.codec = codec;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Call and Phone
+///////////////////////////////////////////////////////////////////////////////
+
+static const char* next_call(void)
+{
+    return (Fake.call_cursor < Fake.calls.size()) ? Fake.calls[Fake.call_cursor++].id.c_str() : "";
+}
+
+static const char* next_endpoint(const char* call_id)
+{
+    FakeCall* call = find_call(call_id);
+    if (!call || (Fake.endpoint_cursor >= call->endpoints.size()))
+        return "";
+    return call->endpoints[Fake.endpoint_cursor++].id.c_str();
+}
+
+static int next_invitation(CallInvitation_t* invite)
+{
+    // invitation_ids holds call and inviter IDs in pairs
+    if (Fake.invitation_cursor + 1 >= Fake.invitation_ids.size())
+        return 0;
+    invite->call_id = Fake.invitation_ids[Fake.invitation_cursor].c_str();
+    invite->endpoint_id = Fake.invitation_ids[Fake.invitation_cursor + 1].c_str();
+    Fake.invitation_cursor += 2;
+    return 1;
+}
+
+static void invite(const char* call_id, const char* endpoint_id)
+{
+    FakeCall* call = find_call(call_id);
+    if (!call || find_endpoint(call, endpoint_id))
+        return;
+    FakeEndpoint ep = {endpoint_id, CALL_STATE_SIGNALING,
+                       Fake.ticks + Fake.config.answer_ticks};
+    call->endpoints.push_back(ep);
+    bump(V_CALL);
+}
+
+void Call_GetLock()
+{
+    FAKE_ENTRY();
+}
+
+void Call_ReleaseLock()
+{
+    FAKE_ENTRY();
+}
+
+const char* Call_Create()
+{
+    FAKE_ENTRY();
+    if (ROLE_CONNECTED != Fake.connect_state)
+        return "";
+    FakeCall call;
+    call.id = make_id(ID_CALL, Fake.next_call++);
+    FakeEndpoint self = {Fake.endpoint_id, CALL_STATE_CONNECTED, 0};
+    call.endpoints.push_back(self);
+    Fake.calls.push_back(call);
+    Fake.created_call = call.id;
+    bump(V_CALL);
+    return Fake.created_call.c_str();
+}
+
+void Call_Invite(const char* call_id, const char* endpoint_id)
+{
+    FAKE_ENTRY();
+    invite(call_id, endpoint_id);
+}
+
+void Call_Invite_Dial(const char* call_id, const char* endpoint_id, const char* dial_number)
+{
+    FAKE_ENTRY();
+    (void)dial_number;
+    invite(call_id, endpoint_id);
+}
+
+void Call_InviteCrew()
+{
+    FAKE_ENTRY();
+}
+
+const char* Call_IDFirst()
+{
+    FAKE_ENTRY();
+    Fake.call_cursor = 0;
+    return next_call();
+}
+
+const char* Call_IDNext()
+{
+    FAKE_ENTRY();
+    return next_call();
+}
+
+int Call_ListCount()
+{
+    FAKE_ENTRY();
+    return (int)Fake.calls.size();
+}
+
+int Call_Endpoint_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_CALL];
+}
+
+const char* Call_Endpoint_IDFirst(const char* call_id)
+{
+    FAKE_ENTRY();
+    Fake.endpoint_cursor = 0;
+    return next_endpoint(call_id);
+}
+
+const char* Call_Endpoint_IDNext(const char* call_id)
+{
+    FAKE_ENTRY();
+    return next_endpoint(call_id);
+}
+
+int Call_Endpoint_State(const char* call_id, const char* ep_id)
+{
+    FAKE_ENTRY();
+    FakeEndpoint* ep = find_endpoint(find_call(call_id), ep_id);
+    return ep ? ep->state : CALL_STATE_NONE;
+}
+
+int Call_Invitation_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_INVITATION];
+}
+
+int Call_Invitation_First(CallInvitation_t* invite)
+{
+    FAKE_ENTRY();
+    Fake.invitation_cursor = 0;
+    return next_invitation(invite);
+}
+
+int Call_Invitation_Next(CallInvitation_t* invite)
+{
+    FAKE_ENTRY();
+    return next_invitation(invite);
+}
+
+void Call_Invitation_ClearAll()
+{
+    FAKE_ENTRY();
+    Fake.invitation_ids.clear();
+}
+
+void Call_Progress(const char* call_id, int call_state)
+{
+    FAKE_ENTRY();
+    FakeEndpoint* ep = find_endpoint(find_call(call_id), Fake.endpoint_id.c_str());
+    if (ep)
+    {   ep->state = call_state;
+        bump(V_CALL);
+    }
+}
+
+void Call_Leave(const char* call_id, int leave_reason)
+{
+    FAKE_ENTRY();
+    (void)leave_reason;
+    for (size_t i = 0; i < Fake.calls.size(); i++)
+    {   if (Fake.calls[i].id == call_id)
+        {   Fake.calls.erase(Fake.calls.begin() + i);
+            if (Fake.phone_call == call_id)
+                Fake.phone_call = "";
+            bump(V_CALL);
+            return;
+        }
+    }
+}
+
+void Call_PressKey(const char* call_id, const char* keys)
+{
+    FAKE_ENTRY();
+    (void)call_id;
+    (void)keys;
+}
+
+void Call_LeaveRequest(const char* call_id, const char* endpoint_id)
+{
+    FAKE_ENTRY();
+    FakeCall* call = find_call(call_id);
+    for (size_t i = 0; call && (i < call->endpoints.size()); i++)
+    {   if ((call->endpoints[i].id == endpoint_id) &&
+            (CALL_STATE_SIGNALING == call->endpoints[i].state))
+        {   call->endpoints.erase(call->endpoints.begin() + i);
+            bump(V_CALL);
+            return;
+        }
+    }
+}
+
+int Phone_ListCount()
+{
+    FAKE_ENTRY();
+    return 1;
+}
+
+const char* Phone_CallActive()
+{
+    FAKE_ENTRY();
+    return Fake.phone_call.c_str();
+}
+
+float Phone_Volume()
+{
+    FAKE_ENTRY();
+    return Fake.phone_volume;
+}
+
+void Phone_SetCall(const char* call_id)
+{
+    FAKE_ENTRY();
+    Fake.phone_call = call_id;
+    FakeEndpoint* ep = find_endpoint(find_call(call_id), Fake.endpoint_id.c_str());
+    if (ep && (CALL_STATE_CONNECTED != ep->state))
+    {   ep->state = CALL_STATE_CONNECTED;
+        bump(V_CALL);
+    }
+}
+
+void Phone_SetVolume(float volume)
+{
+    FAKE_ENTRY();
+    Fake.phone_volume = volume;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Cloud and Operator
+///////////////////////////////////////////////////////////////////////////////
+
+void Cloud_GetLock()
+{
+    FAKE_ENTRY();
+}
+
+void Cloud_ReleaseLock()
+{
+    FAKE_ENTRY();
+}
+
+const char* Cloud_IDFirst()
+{
+    FAKE_ENTRY();
+    Fake.cloud_cursor = 0;
+    return named_next(Fake.clouds, Fake.cloud_cursor);
+}
+
+const char* Cloud_IDNext()
+{
+    FAKE_ENTRY();
+    return named_next(Fake.clouds, Fake.cloud_cursor);
+}
+
+int Cloud_ListCount()
+{
+    FAKE_ENTRY();
+    return (int)Fake.clouds.size();
+}
+
+int Cloud_GetServerCount(const char* uuid)
+{
+    FAKE_ENTRY();
+    return strlen(named_name(Fake.clouds, uuid)) ? 2 : 0;
+}
+
+int Cloud_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_CLOUD];
+}
+
+static const char* next_operator(void)
+{
+    if (Fake.operator_cursor >= Fake.operators.size())
+        return "";
+    return Fake.operators[Fake.operator_cursor++].id.c_str();
+}
+
+void Operator_GetLock()
+{
+    FAKE_ENTRY();
+}
+
+void Operator_ReleaseLock()
+{
+    FAKE_ENTRY();
+}
+
+const char* Operator_IDFirst()
+{
+    FAKE_ENTRY();
+    Fake.operator_cursor = 0;
+    return next_operator();
+}
+
+const char* Operator_IDNext()
+{
+    FAKE_ENTRY();
+    return next_operator();
+}
+
+int Operator_ListCount()
+{
+    FAKE_ENTRY();
+    return (int)Fake.operators.size();
+}
+
+const char* Operator_GetField(const char* uuid, const char* field_name)
+{
+    FAKE_ENTRY();
+    for (size_t i = 0; i < Fake.operators.size(); i++)
+    {   if (Fake.operators[i].id == uuid)
+        {   std::map<std::string, std::string>::const_iterator it =
+                Fake.operators[i].fields.find(field_name);
+            return (it != Fake.operators[i].fields.end()) ? it->second.c_str() : "";
+        }
+    }
+    return "";
+}
+
+int Operator_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_OPERATOR];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// RadCtrl
+///////////////////////////////////////////////////////////////////////////////
+
+int RadCtrl_ListCount()
+{
+    FAKE_ENTRY();
+    return 0;
+}
+
+const char* RadCtrl_Name(int index)
+{
+    FAKE_ENTRY();
+    (void)index;
+    return "";
+}
+
+void RadCtrl_Poll(const char* name)
+{
+    FAKE_ENTRY();
+    (void)name;
+}
+
+const char* RadCtrl_GetValueStr(const char* name, const char* setting)
+{
+    FAKE_ENTRY();
+    (void)name;
+    (void)setting;
+    return "";
+}
+
+const char* RadCtrl_GetOptionsStr(const char* name, const char* setting)
+{
+    FAKE_ENTRY();
+    (void)name;
+    (void)setting;
+    return "";
+}
+
+int RadCtrl_GetValueInt(const char* name, const char* setting)
+{
+    FAKE_ENTRY();
+    (void)name;
+    (void)setting;
+    return 0;
+}
+
+float RadCtrl_GetValueFloat(const char* name, const char* setting)
+{
+    FAKE_ENTRY();
+    (void)name;
+    (void)setting;
+    return 0.0f;
+}
+
+void RadCtrl_SetValueStr(const char* name, const char* setting, const char* value)
+{
+    FAKE_ENTRY();
+    (void)name;
+    (void)setting;
+    (void)value;
+}
+
+void RadCtrl_SetValueInt(const char* name, const char* setting, int value)
+{
+    FAKE_ENTRY();
+    (void)name;
+    (void)setting;
+    (void)value;
+}
+
+void RadCtrl_SetValueFloat(const char* name, const char* setting, float value)
+{
+    FAKE_ENTRY();
+    (void)name;
+    (void)setting;
+    (void)value;
+}
+
+const char* RadCtrl_Error()
+{
+    FAKE_ENTRY();
+    return "";
+}
+
+int RadCtrl_ErrorVersion()
+{
+    FAKE_ENTRY();
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DIS and AuxAudio
+///////////////////////////////////////////////////////////////////////////////
+
+void DIS_SetParams(DISParams_t* dis_params)
+{
+    FAKE_ENTRY();
+    if (dis_params)
+        Fake.dis = *dis_params;
+}
+
+void DIS_GetParams(DISParams_t* dis_params)
+{
+    FAKE_ENTRY();
+    if (dis_params)
+        *dis_params = Fake.dis;
+}
+
+void DIS_SetExercise(int exercise)
+{
+    FAKE_ENTRY();
+    Fake.exercise = exercise;
+}
+
+int DIS_GetExercise()
+{
+    FAKE_ENTRY();
+    return Fake.exercise;
+}
+
+void AuxAudio_Enable(int enable, unsigned int sample_rate, unsigned int encoding)
+{
+    FAKE_ENTRY();
+    (void)enable;
+    (void)sample_rate;
+    (void)encoding;
+}
+
+void AuxAudio_Send(unsigned char* samples, unsigned int len)
+{
+    FAKE_ENTRY();
+    (void)samples;
+    (void)len;
+}
+
+void AuxAudio_Register(AudioCallback func)
+{
+    FAKE_ENTRY();
+    (void)func;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// RadioEffects
+///////////////////////////////////////////////////////////////////////////////
+
+int RadioEffects_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_RADIOEFFECTS];
+}
+
+int RadioEffects_ListCount()
+{
+    FAKE_ENTRY();
+    return (int)Fake.radio_effects.size();
+}
+
+const char* RadioEffects_IDFirst()
+{
+    FAKE_ENTRY();
+    Fake.effects_cursor = 0;
+    return named_next(Fake.radio_effects, Fake.effects_cursor);
+}
+
+const char* RadioEffects_IDNext()
+{
+    FAKE_ENTRY();
+    return named_next(Fake.radio_effects, Fake.effects_cursor);
+}
+
+const char* RadioEffects_Name(const char* radio_effects_id)
+{
+    FAKE_ENTRY();
+    return named_name(Fake.radio_effects, radio_effects_id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Jammer
+///////////////////////////////////////////////////////////////////////////////
+
+int Jammer_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_JAMMER];
+}
+
+int Jammer_ListCount()
+{
+    FAKE_ENTRY();
+    return (int)Fake.jammers.size();
+}
+
+int Jammer_NetListCount(int jammer_index)
+{
+    FAKE_ENTRY();
+    FakeJammer* jammer = find_jammer(jammer_index);
+    return jammer ? (int)jammer->nets.size() : 0;
+}
+
+const char* Jammer_NetName(int jammer_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_jammer_net(jammer_index, net_index);
+    return net ? net->name.c_str() : "";
+}
+
+const char* Jammer_NetID(int jammer_index, int net_index)
+{
+    FAKE_ENTRY();
+    const FakeNet* net = find_jammer_net(jammer_index, net_index);
+    return net ? net->id.c_str() : "";
+}
+
+const char* Jammer_NetIDActive(int jammer_index)
+{
+    FAKE_ENTRY();
+    FakeJammer* jammer = find_jammer(jammer_index);
+    const FakeNet* net = jammer ? find_jammer_net(jammer_index, jammer->active) : NULL;
+    return net ? net->id.c_str() : "";
+}
+
+int Jammer_IsTransmitting(int jammer_index)
+{
+    FAKE_ENTRY();
+    FakeJammer* jammer = find_jammer(jammer_index);
+    return jammer ? (jammer->enabled && (JAMMER_STATE_REPLAYING == jammer->state)) : 0;
+}
+
+void Jammer_SetNetID(int jammer_index, const char* net_id)
+{
+    FAKE_ENTRY();
+    std::string id = net_id;
+    defer([jammer_index, id] {
+        FakeJammer* jammer = find_jammer(jammer_index);
+        for (size_t n = 0; jammer && (n < jammer->nets.size()); n++)
+        {   if (Fake.plan[jammer->nets[n]].id == id)
+            {   jammer->active = (int)n;
+                bump(V_JAMMER);
+                break;
+            }
+        }
+    });
+}
+
+void Jammer_SetEnable(int jammer_index, int enable)
+{
+    FAKE_ENTRY();
+    defer([jammer_index, enable] {
+        FakeJammer* jammer = find_jammer(jammer_index);
+        if (jammer)
+        {   jammer->enabled = enable ? 1 : 0;
+            bump(V_JAMMER);
+        }
+    });
+}
+
+void Jammer_StartRecording(int jammer_index, int duration_secs)
+{
+    FAKE_ENTRY();
+    defer([jammer_index, duration_secs] {
+        FakeJammer* jammer = find_jammer(jammer_index);
+        if (jammer && (JAMMER_STATE_REPLAYING != jammer->state))
+        {   jammer->state = JAMMER_STATE_WAITING;
+            jammer->progress = 0;
+            jammer->length_ms = 1000.0 * (duration_secs > 0 ? duration_secs : 1);
+            bump(V_JAMMER);
+        }
+    });
+}
+
+void Jammer_StopRecording(int jammer_index)
+{
+    FAKE_ENTRY();
+    defer([jammer_index] {
+        FakeJammer* jammer = find_jammer(jammer_index);
+        if (!jammer)
+            return;
+        if (JAMMER_STATE_RECORDING == jammer->state)
+        {   jammer->duration_ms = (int)(now_ms() - jammer->start_ms);
+            jammer->state = JAMMER_STATE_IDLE;
+        }
+        else if (JAMMER_STATE_WAITING == jammer->state)
+            jammer->state = jammer->duration_ms ? JAMMER_STATE_IDLE : JAMMER_STATE_INIT;
+        else
+            return;
+        bump(V_JAMMER);
+    });
+}
+
+void Jammer_StartReplaying(int jammer_index, int loop)
+{
+    FAKE_ENTRY();
+    defer([jammer_index, loop] {
+        FakeJammer* jammer = find_jammer(jammer_index);
+        if (jammer && (JAMMER_STATE_IDLE == jammer->state) && jammer->duration_ms)
+        {   jammer->state = JAMMER_STATE_REPLAYING;
+            jammer->loop = loop;
+            jammer->start_ms = now_ms();
+            jammer->progress = 0;
+            bump(V_JAMMER);
+        }
+    });
+}
+
+void Jammer_StopReplaying(int jammer_index)
+{
+    FAKE_ENTRY();
+    defer([jammer_index] {
+        FakeJammer* jammer = find_jammer(jammer_index);
+        if (jammer && (JAMMER_STATE_REPLAYING == jammer->state))
+        {   jammer->state = JAMMER_STATE_IDLE;
+            bump(V_JAMMER);
+        }
+    });
+}
+
+int Jammer_RecordReplayState(int jammer_index)
+{
+    FAKE_ENTRY();
+    FakeJammer* jammer = find_jammer(jammer_index);
+    return jammer ? jammer->state : 0;
+}
+
+int Jammer_RecordReplayProgress(int jammer_index)
+{
+    FAKE_ENTRY();
+    FakeJammer* jammer = find_jammer(jammer_index);
+    return jammer ? jammer->progress : 0;
+}
+
+int Jammer_RecordReplayDurationMs(int jammer_index)
+{
+    FAKE_ENTRY();
+    FakeJammer* jammer = find_jammer(jammer_index);
+    return jammer ? jammer->duration_ms : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AudioDevice, License, Playsound
+///////////////////////////////////////////////////////////////////////////////
+
+static int valid_device_type(AudioDeviceType_t type)
+{
+    return (type >= AUDIO_DEVICE_PLAYBACK) && (type < AUDIO_DEVICE_TOTAL);
+}
+
+const char* AudioDevice_IDActive(AudioDeviceType_t type)
+{
+    FAKE_ENTRY();
+    return valid_device_type(type) ? Fake.device_active[type].c_str() : "";
+}
+
+const char* AudioDevice_IDFirst(AudioDeviceType_t type)
+{
+    FAKE_ENTRY();
+    if (!valid_device_type(type))
+        return "";
+    Fake.device_cursor[type] = 0;
+    return named_next(Fake.devices[type], Fake.device_cursor[type]);
+}
+
+const char* AudioDevice_IDNext(AudioDeviceType_t type)
+{
+    FAKE_ENTRY();
+    return valid_device_type(type) ? named_next(Fake.devices[type], Fake.device_cursor[type]) : "";
+}
+
+const char* AudioDevice_Name(AudioDeviceType_t type, const char* id)
+{
+    FAKE_ENTRY();
+    return valid_device_type(type) ? named_name(Fake.devices[type], id) : "";
+}
+
+void AudioDevice_SetDevice(AudioDeviceType_t type, const char* id)
+{
+    FAKE_ENTRY();
+    if (valid_device_type(type) && strlen(named_name(Fake.devices[type], id)))
+    {   Fake.device_active[type] = id;
+        bump(V_AUDIODEVICE);
+    }
+}
+
+int AudioDevice_Version()
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_AUDIODEVICE];
+}
+
+int License_Request(const char* type)
+{
+    FAKE_ENTRY();
+    (void)type;
+    int id = Fake.next_license++;
+    Fake.licenses[id] = LICENSE_STATUS_GRANTED;
+    return id;
+}
+
+void License_Release(int license_id)
+{
+    FAKE_ENTRY();
+    if (Fake.licenses.count(license_id))
+        Fake.licenses[license_id] = LICENSE_STATUS_RELEASED;
+}
+
+int License_Status(int license_id)
+{
+    FAKE_ENTRY();
+    return Fake.licenses.count(license_id) ? Fake.licenses[license_id] : LICENSE_STATUS_LOST;
+}
+
+int Playsound_ListCount(void)
+{
+    FAKE_ENTRY();
+    return (int)Fake.playsounds.size();
+}
+
+const char* Playsound_Name(const char* playsound_id)
+{
+    FAKE_ENTRY();
+    return named_name(Fake.playsounds, playsound_id);
+}
+
+const char* Playsound_Id(int playsound_index)
+{
+    FAKE_ENTRY();
+    if ((playsound_index < 0) || (playsound_index >= (int)Fake.playsounds.size()))
+        return "";
+    return Fake.playsounds[playsound_index].id.c_str();
+}
+
+int Playsound_Version(void)
+{
+    FAKE_ENTRY();
+    return Fake.versions[V_PLAYSOUND];
+}
@@ -0,0 +1,115 @@
+/*
+ *  Offline libvrcc stand-in control interface
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * \file fake_vrcc.h
+ * \brief Control interface of the offline libvrcc stand-in
+ * \details The vrcc-fake library implements every function in vrcc.h
+ * against a simulated server, so the example, benchmarks and the fleet
+ * launcher can run without a Voisus server. Simulation time advances on
+ * every VRCC_Update(), either by a fixed step (deterministic) or with the
+ * wall clock.
+ *
+ * The stand-in is configured from the environment when VRCC_Start() is
+ * called, unless FakeVrcc_Configure() was called first:
+ *
+ * Variable                     | Meaning
+ * ---------------------------- | ---------------------------------------------
+ * VRCC_FAKE_RADIOS             | Radios in the connected role
+ * VRCC_FAKE_NETS               | Nets assigned to each radio
+ * VRCC_FAKE_PLAN_NETS          | Nets in the comm plan, shared between radios
+ * VRCC_FAKE_JAMMERS            | Jammers in the connected role
+ * VRCC_FAKE_JAMMER_NETS        | Nets assigned to each jammer
+ * VRCC_FAKE_ROLES              | Roles offered by the server
+ * VRCC_FAKE_OPERATORS          | Operators published by the server
+ * VRCC_FAKE_CALLS              | Calls present when the role connects
+ * VRCC_FAKE_CALL_ENDPOINTS     | Endpoints on each of those calls
+ * VRCC_FAKE_CONNECTED          | 1 to start connected to the first role
+ * VRCC_FAKE_TICK_MS            | Simulated ms per VRCC_Update, 0 for wall clock
+ * VRCC_FAKE_APPLY_TICKS        | Updates before a setter takes effect
+ * VRCC_FAKE_ANSWER_TICKS       | Updates before an invited endpoint connects
+ * VRCC_FAKE_ACTIVITY           | Chance per radio per update (per mille) of rx/tx toggling
+ * VRCC_FAKE_SEED               | Seed for the activity generator
+ * VRCC_FAKE_LATENCY            | Call latencies, e.g. "Voisus_ConnectServer=200000,*=1" (us)
+ * VRCC_FAKE_SCRIPT             | File of scripted events, see FakeVrcc_Script
+ */
+
+#ifndef FAKE_VRCC_H
+#define FAKE_VRCC_H
+
+#include "vrcc.h"
+
+/// Scale and timing of the simulated server
+typedef struct
+{
+    int         radios;             ///< Radios in the connected role
+    int         nets_per_radio;     ///< Nets assigned to each radio
+    int         plan_nets;          ///< Nets in the comm plan
+    int         jammers;            ///< Jammers in the connected role
+    int         nets_per_jammer;    ///< Nets assigned to each jammer
+    int         roles;              ///< Roles offered by the server
+    int         operators;          ///< Operators published by the server
+    int         calls;              ///< Calls present when the role connects
+    int         endpoints_per_call; ///< Endpoints on each of those calls
+    int         connected;          ///< 1 to start connected to the first role
+    int         tick_ms;            ///< Simulated ms per update, 0 for wall clock
+    int         apply_ticks;        ///< Updates before a setter takes effect
+    int         answer_ticks;       ///< Updates before an invited endpoint connects
+    int         activity_permille;  ///< Chance per radio per update of rx/tx toggling
+    unsigned    seed;               ///< Seed for the activity generator
+} FakeVrccConfig_t;
+
+/// @brief Fills a configuration with defaults overridden by the environment
+VRCC_API void FakeVrcc_DefaultConfig(FakeVrccConfig_t* config);
+
+/// @brief Sets the configuration used by the next VRCC_Start()
+/// @details Resets all simulated state, latencies and scripted events.
+VRCC_API void FakeVrcc_Configure(const FakeVrccConfig_t* config);
+
+/// @brief Sets the latency injected into a function
+/// @param function name of a vrcc.h function, or "*" for every function
+/// @param usec latency in microseconds
+VRCC_API void FakeVrcc_SetLatency(const char* function, unsigned int usec);
+
+/// @brief Adds a scripted event
+/// @details Events have the form "<tick> <action> [args]" or
+/// "every <ticks> <action> [args]". A radio or jammer index of * applies
+/// the action to all of them. Actions:
+///  - rx <radio> <0|1|toggle>: set receiving
+///  - tx <radio> <0|1|toggle>: set transmitting
+///  - level <radio> <0.0-1.0>: set received audio level
+///  - net <radio> <net index>: server-side retune
+///  - jammer_state <jammer> <state>: set ::JammerRecordReplayState_t
+///  - jammer_progress <jammer> <percent>: set record/replay progress
+///  - operator <index> <field> <value>: change an operator field
+///  - invite <operator index>: invitation to a new call from an operator
+///  - bump <domain>: bump a version counter (radio, jammer, role, ...)
+///  - disconnect: server drops the connection
+/// Lines starting with # are ignored.
+/// @returns 1 if the event was parsed, 0 otherwise
+VRCC_API int FakeVrcc_Script(const char* line);
+
+/// @brief Gets the number of VRCC_Update() calls since VRCC_Start()
+VRCC_API unsigned long FakeVrcc_Ticks(void);
+
+#endif
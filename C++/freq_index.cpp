@@ -0,0 +1,65 @@
+/*
+ *  Voisus SDK Example frequency index
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "freq_index.h"
+#include <algorithm>
+
+static bool before(const FreqEntry& a, const FreqEntry& b)
+{
+    if (a.frequency != b.frequency)
+        return a.frequency < b.frequency;
+    if (a.radio != b.radio)
+        return a.radio < b.radio;
+    if (a.net != b.net)
+        return a.net < b.net;
+    return a.use < b.use;
+}
+
+static bool below(const FreqEntry& entry, unsigned long long frequency)
+{
+    return entry.frequency < frequency;
+}
+
+static bool above(unsigned long long frequency, const FreqEntry& entry)
+{
+    return frequency < entry.frequency;
+}
+
+void FreqIndex::add(unsigned long long frequency, int radio, int net, int use)
+{
+    FreqEntry entry = {frequency, radio, net, use};
+    sorted.push_back(entry);
+}
+
+void FreqIndex::sort(void)
+{
+    std::sort(sorted.begin(), sorted.end(), before);
+}
+
+size_t FreqIndex::range(unsigned long long low, unsigned long long high, size_t& first) const
+{
+    std::vector<FreqEntry>::const_iterator begin = std::lower_bound(sorted.begin(), sorted.end(), low, below);
+    std::vector<FreqEntry>::const_iterator end = std::upper_bound(begin, sorted.end(), high, above);
+    first = begin - sorted.begin();
+    return (begin < end) ? end - begin : 0;
+}
@@ -0,0 +1,70 @@
+/*
+ *  Voisus SDK Example frequency index
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef FREQ_INDEX_H
+#define FREQ_INDEX_H
+
+#include <stddef.h>
+#include <vector>
+
+/// What a frequency index entry refers to
+enum FreqUse_t
+{
+    FREQ_NET,                       ///< Frequency of a net assigned to the radio
+    FREQ_RX_ACTIVE,                 ///< Receive frequency of the radio's active net
+    FREQ_TX_ACTIVE                  ///< Transmit frequency of the radio's active net
+};
+
+/// Frequency used by a radio
+struct FreqEntry
+{
+    unsigned long long  frequency;          ///< Frequency in Hz
+    int                 radio;              ///< Radio index
+    int                 net;                ///< Net index, -1 for an active frequency with no assigned net
+    int                 use;                ///< ::FreqUse_t
+};
+
+/// @brief Every frequency of every radio in one array sorted by frequency
+/// @details Built once per radio refresh; lookups are binary searches.
+class FreqIndex
+{
+public:
+    /// @brief Adds an entry, call sort() when done
+    void add(unsigned long long frequency, int radio, int net, int use);
+
+    /// @brief Sorts the entries by frequency, then radio, net and use
+    void sort(void);
+
+    /// @brief Finds the entries with a frequency in [low, high]
+    /// @param first Receives the index of the first match
+    /// @returns number of matches, at entries()[first] onward
+    size_t range(unsigned long long low, unsigned long long high, size_t& first) const;
+
+    /// @brief Gets the sorted entries
+    const std::vector<FreqEntry>& entries(void) const { return sorted; }
+
+private:
+    std::vector<FreqEntry> sorted;
+};
+
+#endif
@@ -0,0 +1,198 @@
+/*
+ *  Voisus SDK Example call invitation inbox
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "inbox.h"
+#include "refresh.h"
+#include "vrcc_timed.h"
+#include <set>
+#include <stdio.h>
+#include <string.h>
+#include <utility>
+
+typedef std::pair<uint64_t, uint64_t> CALL_T;
+
+static std::vector<InboxRule> Rules;
+static std::vector<InboxEntry> Pending;
+static std::set<CALL_T> Seen;               // Calls already invited, so repeats are dropped
+static std::vector<inbox_callback> Callbacks;
+
+static CALL_T call_of(const char* call_id)
+{
+    CallKey key;
+    call_key(call_id, key);
+    return CALL_T(key.hi, key.lo);
+}
+
+int inbox_parse_rule(const char* text, InboxRule& rule, char* error, size_t errsz)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s", text);
+    const char* action = strtok(buf, " \t");
+    rule.when = INBOX_ANY;
+    rule.from.clear();
+    if (action && !strcmp(action, "accept"))
+        rule.action = INBOX_ACCEPT;
+    else if (action && !strcmp(action, "reject"))
+        rule.action = INBOX_REJECT;
+    else if (action && !strcmp(action, "keep"))
+        rule.action = INBOX_KEEP;
+    else
+    {   snprintf(error, errsz, "expected accept, reject or keep");
+        return 0;
+    }
+    for (char* opt = strtok(NULL, " \t"); opt; opt = strtok(NULL, " \t"))
+    {   char* value = strchr(opt, '=');
+        if (value)
+            *value++ = '\0';
+        if (value && !strcmp(opt, "from") && *value)
+            rule.from = (strcmp(value, "*") ? value : "");
+        else if (value && !strcmp(opt, "when") && !strcmp(value, "idle"))
+            rule.when = INBOX_IDLE;
+        else if (value && !strcmp(opt, "when") && !strcmp(value, "busy"))
+            rule.when = INBOX_BUSY;
+        else if (value && !strcmp(opt, "when") && !strcmp(value, "any"))
+            rule.when = INBOX_ANY;
+        else
+        {   snprintf(error, errsz, "bad option %s%s%s", opt, value ? "=" : "", value ? value : "");
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void inbox_set_rules(const std::vector<InboxRule>& rules)
+{
+    Rules = rules;
+}
+
+const std::vector<InboxRule>& inbox_rules(void)
+{
+    return Rules;
+}
+
+void inbox_on_invitation(const inbox_callback& callback)
+{
+    Callbacks.push_back(callback);
+}
+
+// On a call other than the one inviting, as far as the call table knows
+static int busy_for(const DomainCaches& caches, const std::string& call_id)
+{
+    const char* active = Phone_CallActive();
+    return active && *active && (call_id != active) && caches.calls->find(active);
+}
+
+// op is the inviter's index in the operator table, -1 if not an operator
+static int match(const InboxRule& rule, const InboxEntry& entry, const OperatorTable& operators, int op)
+{
+    if (((INBOX_IDLE == rule.when) && entry.busy) || ((INBOX_BUSY == rule.when) && !entry.busy))
+        return 0;
+    return rule.from.empty() || (rule.from == entry.endpoint_id) ||
+           ((op >= 0) && ((rule.from == operators.field(OPERATOR_CLIENTNAME, op)) ||
+                          (rule.from == operators.field(OPERATOR_ROLE, op))));
+}
+
+static void answer(const InboxEntry& entry)
+{
+    if (INBOX_ACCEPT == entry.action)
+        Phone_SetCall(entry.call_id.c_str());
+    else if (INBOX_REJECT == entry.action)
+        Call_Leave(entry.call_id.c_str(), entry.busy ? CALL_LEAVE_BUSY : CALL_LEAVE_REJECTED);
+}
+
+// Drops kept invitations, and remembered calls, that have since ended
+static void prune(void)
+{
+    const CallTable& calls = *refresh_caches().calls;
+    for (size_t i = Pending.size(); i-- > 0; )
+    {   if (!calls.find(Pending[i].call_id.c_str()))
+            Pending.erase(Pending.begin() + i);
+    }
+    if (Seen.size() > 4 * (calls.size() + 16))
+    {   std::set<CALL_T> live;
+        for (size_t c = 0; c < calls.size(); c++)
+            live.insert(CALL_T(calls[c].key.hi, calls[c].key.lo));
+        Seen.swap(live);
+    }
+}
+
+void inbox_update(unsigned int refreshed)
+{
+    if (!(refreshed & (1u << DOMAIN_INVITATION)))
+        return;
+    // The refresh engine has just walked Call_Invitation_First/Next
+    const DomainCaches& caches = refresh_caches();
+    const std::vector<InvitationInfo>& invitations = *caches.invitations;
+    for (size_t i = 0; i < invitations.size(); i++)
+    {   const InvitationInfo& invite = invitations[i];
+        if (!Seen.insert(call_of(invite.call_id.c_str())).second)
+            continue;
+        InboxEntry entry;
+        entry.call_id = invite.call_id;
+        entry.endpoint_id = invite.endpoint_id;
+        const OperatorTable& operators = *caches.operators;
+        int op = operators.find(invite.endpoint_id.c_str());
+        entry.from = (op >= 0) ? operators.field(OPERATOR_CLIENTNAME, op) : invite.endpoint_id;
+        entry.busy = busy_for(caches, entry.call_id);
+        entry.action = INBOX_KEEP;
+        entry.rule = -1;
+        for (size_t r = 0; r < Rules.size(); r++)
+        {   if (match(Rules[r], entry, operators, op))
+            {   entry.action = Rules[r].action;
+                entry.rule = (int)r;
+                break;
+            }
+        }
+        answer(entry);
+        if (INBOX_KEEP == entry.action)
+            Pending.push_back(entry);
+        for (size_t c = 0; c < Callbacks.size(); c++)
+            Callbacks[c](entry);
+    }
+    // Clearing an empty list would only move the version again
+    if (!invitations.empty())
+        Call_Invitation_ClearAll();
+    // Unattended stations never list the inbox, so prune here too
+    prune();
+}
+
+std::vector<InboxEntry> inbox_pending(void)
+{
+    prune();
+    return Pending;
+}
+
+int inbox_answer(const char* call_id, int action)
+{
+    prune();
+    for (size_t i = 0; i < Pending.size(); i++)
+    {   if (Pending[i].call_id == call_id)
+        {   Pending[i].action = action;
+            Pending[i].busy = busy_for(refresh_caches(), Pending[i].call_id);
+            answer(Pending[i]);
+            Pending.erase(Pending.begin() + i);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ *  Voisus SDK Example call invitation inbox
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef INBOX_H
+#define INBOX_H
+
+#include <functional>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+/// What to do with an invitation
+enum InboxAction_t
+{
+    INBOX_KEEP,                             ///< Leave it for inbox_answer()
+    INBOX_ACCEPT,                           ///< Join the call with Phone_SetCall
+    INBOX_REJECT,                           ///< Call_Leave with CALL_LEAVE_BUSY or CALL_LEAVE_REJECTED
+};
+
+/// Phone state a rule applies in
+enum InboxWhen_t
+{
+    INBOX_ANY,
+    INBOX_IDLE,                             ///< Not on another call
+    INBOX_BUSY,                             ///< On another call
+};
+
+/// Auto-answer rule; the first rule that matches an invitation decides
+struct InboxRule
+{
+    int                 action;             ///< ::InboxAction_t
+    int                 when;               ///< ::InboxWhen_t
+    std::string         from;               ///< Inviter endpoint ID, client name or role, empty for anyone
+};
+
+/// Invitation and what was done with it
+struct InboxEntry
+{
+    std::string         call_id;            ///< Unique ID of the call
+    std::string         endpoint_id;        ///< Unique ID of the inviter
+    std::string         from;               ///< Inviter client name, or its endpoint ID if not an operator
+    int                 busy;               ///< 1 if on another call when it arrived
+    int                 action;             ///< ::InboxAction_t taken
+    int                 rule;               ///< Index of the deciding rule, -1 for none
+};
+
+/// Called on the libvrcc thread
+typedef std::function<void(const InboxEntry&)> inbox_callback;
+
+/// @brief Parses a rule: accept|reject|keep [from=<endpoint|name>] [when=idle|busy]
+/// @param error Receives a message when the rule is rejected
+/// @returns 1 on success, 0 on error
+int inbox_parse_rule(const char* text, InboxRule& rule, char* error, size_t errsz);
+
+/// @brief Replaces the rule table
+/// @details Invitations no rule matches are kept.
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+void inbox_set_rules(const std::vector<InboxRule>& rules);
+
+/// @brief Gets the rule table
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+const std::vector<InboxRule>& inbox_rules(void);
+
+/// @brief Answers new invitations
+/// @details Called on every update tick. When the refresh engine has just
+/// re-read the invitations, each call not seen before is matched against the
+/// rules and answered, callbacks fire, and the library's list is cleared
+/// with Call_Invitation_ClearAll.
+/// @param refreshed result of refresh_update()
+/// @note Must be called from the thread that owns libvrcc.
+void inbox_update(unsigned int refreshed);
+
+/// @brief Adds a callback fired for every new invitation, after it is answered
+/// @note Must be called from the thread that owns libvrcc.
+void inbox_on_invitation(const inbox_callback& callback);
+
+/// @brief Gets the kept invitations whose calls still exist
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+std::vector<InboxEntry> inbox_pending(void);
+
+/// @brief Accepts or rejects a kept invitation
+/// @param action ::InboxAction_t
+/// @returns 1 if the invitation was pending
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+int inbox_answer(const char* call_id, int action);
+
+#endif
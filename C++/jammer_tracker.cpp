@@ -0,0 +1,150 @@
+/*
+ *  Voisus SDK Example jammer record/replay tracker
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "jammer_tracker.h"
+#include "vrcc_timed.h"
+#include <chrono>
+#include <memory>
+#include <vector>
+
+typedef struct {
+    JammerStatus status;
+    unsigned long transitions;              // State changes seen
+    unsigned long started;                  // transitions when last started, or ~0
+    std::chrono::steady_clock::time_point start;
+} TRACKED_T;
+
+typedef struct {
+    int jammer;
+    int state;
+    std::chrono::steady_clock::time_point expires;
+    std::shared_ptr<std::promise<JammerStatus> > done;
+} AWAIT_T;
+
+static std::vector<TRACKED_T> Tracked;
+static std::vector<AWAIT_T> Awaits;
+static std::vector<jammer_callback> Callbacks;
+
+static int reached(const TRACKED_T& tracked, int state)
+{
+    return (tracked.status.state == state) &&
+           ((~0ul == tracked.started) || (tracked.transitions > tracked.started));
+}
+
+static void update_elapsed(TRACKED_T& tracked)
+{
+    tracked.status.elapsed_ms = (~0ul == tracked.started) ? 0 :
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tracked.start).count();
+}
+
+void jammer_track(void)
+{
+    int count = Jammer_ListCount();
+    if (count != (int)Tracked.size())
+    {   size_t old = Tracked.size();
+        Tracked.resize(count);
+        for (size_t j = old; j < Tracked.size(); j++)
+        {   Tracked[j].status.jammer = (int)j;
+            Tracked[j].status.state = Tracked[j].status.previous = Jammer_RecordReplayState((int)j);
+            Tracked[j].transitions = 0;
+            Tracked[j].started = ~0ul;
+        }
+    }
+
+    int changed = 0;
+    for (int j = 0; j < count; j++)
+    {   TRACKED_T& tracked = Tracked[j];
+        JammerStatus& status = tracked.status;
+        int state = Jammer_RecordReplayState(j);
+        status.progress = Jammer_RecordReplayProgress(j);
+        status.duration_ms = Jammer_RecordReplayDurationMs(j);
+        if (state == status.state)
+            continue;
+        status.previous = status.state;
+        status.state = state;
+        tracked.transitions++;
+        changed = 1;
+        update_elapsed(tracked);
+        if ((JAMMER_STATE_IDLE == state) && ((JAMMER_STATE_WAITING == status.previous) ||
+            (JAMMER_STATE_RECORDING == status.previous) || (JAMMER_STATE_REPLAYING == status.previous)))
+        {   for (size_t c = 0; c < Callbacks.size(); c++)
+                Callbacks[c](status);
+        }
+    }
+    if (!changed && Awaits.empty())
+        return;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for (size_t a = 0; a < Awaits.size();)
+    {   AWAIT_T& await = Awaits[a];
+        int exists = (await.jammer < count);
+        if (exists && reached(Tracked[await.jammer], await.state))
+            await.done->set_value(Tracked[await.jammer].status);
+        else if (now >= await.expires)
+        {   JammerStatus status = {await.jammer, -1, -1, 0, 0, 0, 1};
+            if (exists)
+            {   update_elapsed(Tracked[await.jammer]);
+                status = Tracked[await.jammer].status;
+                status.timed_out = 1;
+            }
+            await.done->set_value(status);
+        }
+        else
+        {   a++;
+            continue;
+        }
+        Awaits.erase(Awaits.begin() + a);
+    }
+}
+
+void jammer_track_start(int jammer)
+{
+    jammer_track();
+    if ((jammer < 0) || (jammer >= (int)Tracked.size()))
+        return;
+    Tracked[jammer].started = Tracked[jammer].transitions;
+    Tracked[jammer].start = std::chrono::steady_clock::now();
+}
+
+void jammer_on_complete(const jammer_callback& callback)
+{
+    Callbacks.push_back(callback);
+}
+
+std::future<JammerStatus> jammer_await(int jammer, int state, int timeout_ms)
+{
+    AWAIT_T await = {jammer, state, std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms),
+                     std::make_shared<std::promise<JammerStatus> >()};
+    std::future<JammerStatus> future = await.done->get_future();
+    jammer_track();
+    if ((jammer < 0) || (jammer >= (int)Tracked.size()))
+    {   JammerStatus missing = {jammer, -1, -1, 0, 0, 0, 0};
+        await.done->set_value(missing);
+    }
+    else if (reached(Tracked[jammer], state))
+    {   update_elapsed(Tracked[jammer]);
+        await.done->set_value(Tracked[jammer].status);
+    }
+    else
+        Awaits.push_back(await);
+    return future;
+}
@@ -0,0 +1,74 @@
+/*
+ *  Voisus SDK Example jammer record/replay tracker
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef JAMMER_TRACKER_H
+#define JAMMER_TRACKER_H
+
+#include <functional>
+#include <future>
+
+/// Record/replay state of a jammer as seen by the tracker
+struct JammerStatus
+{
+    int                 jammer;             ///< Jammer index
+    int                 state;              ///< ::JammerRecordReplayState_t, -1 if there is no such jammer
+    int                 previous;           ///< State before the last transition
+    int                 progress;           ///< Record/replay progress in percent
+    int                 duration_ms;        ///< Record/replay duration
+    double              elapsed_ms;         ///< Time since the last jammer_track_start()
+    int                 timed_out;          ///< 1 if jammer_await() gave up before the state was reached
+};
+
+/// Called on the libvrcc thread
+typedef std::function<void(const JammerStatus&)> jammer_callback;
+
+/// @brief Polls the record/replay state of every jammer
+/// @details Called on every update tick. Fires completion callbacks and
+/// completes awaits.
+/// @note Must be called from the thread that owns libvrcc.
+void jammer_track(void);
+
+/// @brief Notes that a recording or replay was just requested on a jammer
+/// @details Awaits then complete only on a state reached after this request,
+/// not on the state the jammer was still in when it was made.
+/// @note Must be called from the thread that owns libvrcc.
+void jammer_track_start(int jammer);
+
+/// @brief Adds a callback fired whenever a jammer returns to IDLE from
+/// waiting, recording or replaying
+/// @note Must be called from the thread that owns libvrcc.
+void jammer_on_complete(const jammer_callback& callback);
+
+/// @brief Gets a future completed when a jammer reaches a state
+/// @details Completes at once if the jammer is in the state and has not
+/// been started since it got there. The future is completed on the libvrcc
+/// thread, so waiting on it from another thread never stalls updates.
+/// After timeout_ms, checked on every update tick, the await is dropped and
+/// its future completed with timed_out set.
+/// @param state ::JammerRecordReplayState_t
+/// @returns future of the jammer's status, whose state is -1 if there is no
+/// such jammer
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+std::future<JammerStatus> jammer_await(int jammer, int state, int timeout_ms);
+
+#endif
@@ -0,0 +1,184 @@
+/*
+ *  Voisus SDK Example JSON lines writer
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "json_writer.h"
+#include <string.h>
+#include <cmath>
+
+JsonWriter::JsonWriter(FILE* out)
+    : out(out), len(0), overflow(0)
+{
+}
+
+void JsonWriter::append(const char* str, size_t n)
+{
+    // Keep room for the closing "}\n"
+    if (overflow || (len + n + 2 > sizeof(buf)))
+    {   overflow = 1;
+        return;
+    }
+    memcpy(buf + len, str, n);
+    len += n;
+}
+
+void JsonWriter::append_escaped(const char* str, size_t n)
+{
+    static const char hex[] = "0123456789abcdef";
+    size_t start = 0;
+    for (size_t i = 0; i < n; i++)
+    {   unsigned char c = str[i];
+        if ((c >= 0x20) && (c != '"') && (c != '\\'))
+            continue;
+        append(str + start, i - start);
+        start = i + 1;
+        switch (c)
+        {   case '"': append("\\\"", 2); break;
+            case '\\': append("\\\\", 2); break;
+            case '\n': append("\\n", 2); break;
+            case '\r': append("\\r", 2); break;
+            case '\t': append("\\t", 2); break;
+            default:
+            {   char esc[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 15]};
+                append(esc, sizeof(esc));
+            }
+        }
+    }
+    append(str + start, n - start);
+}
+
+void JsonWriter::append_unsigned(unsigned long long value)
+{
+    char digits[20];
+    size_t n = 0;
+    do
+    {   digits[sizeof(digits) - ++n] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    append(digits + sizeof(digits) - n, n);
+}
+
+void JsonWriter::key(const char* key)
+{
+    append(",\"", 2);
+    append_escaped(key, strlen(key));
+    append("\":", 2);
+}
+
+JsonWriter& JsonWriter::begin(const char* type)
+{
+    len = 0;
+    overflow = 0;
+    append("{\"type\":\"", 9);
+    append_escaped(type, strlen(type));
+    append("\"", 1);
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* name, const char* value)
+{
+    key(name);
+    append("\"", 1);
+    append_escaped(value, strlen(value));
+    append("\"", 1);
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* name, const std::string& value)
+{
+    key(name);
+    append("\"", 1);
+    append_escaped(value.data(), value.size());
+    append("\"", 1);
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* name, int value)
+{
+    return field(name, (long long)value);
+}
+
+JsonWriter& JsonWriter::field(const char* name, unsigned int value)
+{
+    return field(name, (unsigned long long)value);
+}
+
+JsonWriter& JsonWriter::field(const char* name, long long value)
+{
+    key(name);
+    if (value < 0)
+    {   append("-", 1);
+        append_unsigned(0ULL - (unsigned long long)value);
+    }
+    else
+        append_unsigned(value);
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* name, unsigned long long value)
+{
+    key(name);
+    append_unsigned(value);
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* name, double value)
+{
+    char num[32];
+    key(name);
+    // JSON has no NaN or infinity
+    if (!std::isfinite(value))
+    {   append("null", 4);
+        return *this;
+    }
+    // %.3f would print every integer digit of a huge value, so past 1e15
+    // fall back to an exponent, which fits num at any magnitude
+    int n = snprintf(num, sizeof(num), (std::fabs(value) < 1e15) ? "%.3f" : "%.17g", value);
+    if (n >= (int)sizeof(num))
+        n = sizeof(num) - 1;
+    append(num, (n > 0) ? n : 0);
+    return *this;
+}
+
+JsonWriter& JsonWriter::flag(const char* name, int value)
+{
+    key(name);
+    if (value)
+        append("true", 4);
+    else
+        append("false", 5);
+    return *this;
+}
+
+void JsonWriter::end(void)
+{
+    static const char truncated[] = "{\"type\":\"error\",\"text\":\"JSON record truncated\"}\n";
+    if (overflow)
+        fwrite(truncated, 1, sizeof(truncated) - 1, out);
+    else
+    {   buf[len++] = '}';
+        buf[len++] = '\n';
+        fwrite(buf, 1, len, out);
+    }
+    len = 0;
+    overflow = 0;
+}
@@ -0,0 +1,76 @@
+/*
+ *  Voisus SDK Example JSON lines writer
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdio.h>
+#include <string>
+
+/// @brief Writes compact JSON objects, one per line, from a fixed buffer
+/// @details Every object starts with a "type" member. Nothing is allocated:
+/// members are formatted straight into the buffer, which is written with a
+/// single fwrite() by end(). The caller flushes once at the end of a
+/// command or batch rather than after every object. An object that does not fit is replaced by a
+/// {"type":"error"} object rather than being split.
+///
+///     Json.begin("radio").field("index", 0).flag("receiving", 1).end();
+class JsonWriter
+{
+public:
+    enum { BUFFER_SIZE = 4096 };
+
+    explicit JsonWriter(FILE* out = stdout);
+
+    /// Starts an object with the given "type" member
+    JsonWriter& begin(const char* type);
+
+    JsonWriter& field(const char* key, const char* value);
+    JsonWriter& field(const char* key, const std::string& value);
+    JsonWriter& field(const char* key, int value);
+    JsonWriter& field(const char* key, unsigned int value);
+    JsonWriter& field(const char* key, long long value);
+    JsonWriter& field(const char* key, unsigned long long value);
+    /// Adds a number with 3 decimals (in exponent form from 1e15), or null if
+    /// it is not finite
+    JsonWriter& field(const char* key, double value);
+
+    /// Adds a member as true or false
+    JsonWriter& flag(const char* key, int value);
+
+    /// Finishes the object and writes it as one line
+    void end(void);
+
+private:
+    void key(const char* key);
+    void append(const char* str, size_t len);
+    void append_escaped(const char* str, size_t len);
+    void append_unsigned(unsigned long long value);
+
+    FILE* out;
+    size_t len;
+    int overflow;
+    char buf[BUFFER_SIZE];
+};
+
+#endif
@@ -0,0 +1,189 @@
+/*
+ *  Voisus SDK Example audio level meters
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "meter.h"
+#include "refresh.h"
+#include "vrcc_timed.h"
+#include <math.h>
+#include <chrono>
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define METER_SSE 1
+#endif
+
+// Sampler state, in lanes padded to a multiple of 4 radios. Masks are all
+// ones or all zeros so the kernel can select without branching.
+typedef struct {
+    int enabled;
+    size_t count;                           // Radios with levels enabled
+    std::vector<float> level;
+    std::vector<float> peak;
+    std::vector<float> mean_sq;
+    std::vector<float> rms;
+    std::vector<float> clip_ms;             // Remaining clip hold
+    std::vector<float> silent_ms;           // Silence so far while receiving
+    std::vector<unsigned int> rx_mask;      // All ones while receiving
+    std::vector<unsigned int> clips;
+    std::shared_ptr<const std::vector<unsigned char> > flags;
+    std::chrono::steady_clock::time_point last;
+} METER_T;
+
+static METER_T Meter;
+static std::shared_ptr<const MeterTable> Published;
+
+static void resize(size_t count)
+{
+    size_t lanes = (count + 3) & ~(size_t)3;
+    Meter.level.resize(lanes);
+    Meter.peak.resize(lanes);
+    Meter.mean_sq.resize(lanes);
+    Meter.rms.resize(lanes);
+    Meter.clip_ms.resize(lanes);
+    Meter.silent_ms.resize(lanes);
+    Meter.rx_mask.resize(lanes);
+    Meter.clips.resize(lanes);
+}
+
+void meter_enable(int enable)
+{
+    const DomainCaches& caches = refresh_caches();
+    size_t count = caches.radios ? caches.radios->size() : 0;
+    for (size_t i = 0; i < count; i++)
+        Radio_SetAudioLevelEnable((int)i, enable);
+    Meter = METER_T();
+    Meter.enabled = enable;
+    Meter.count = enable ? count : 0;
+    Meter.last = std::chrono::steady_clock::now();
+    resize(Meter.count);
+    std::atomic_store(&Published, std::shared_ptr<const MeterTable>());
+}
+
+// Clip events are rare, so they are counted outside the vector kernel
+static void count_clip(size_t lane, int clipped)
+{
+    for (int i = 0; clipped; i++, clipped >>= 1)
+    {   if (clipped & 1)
+            Meter.clips[lane + i]++;
+    }
+}
+
+// Updates peak, RMS, clip hold and silence for every lane
+static void kernel(float dt_ms, float peak_decay, float rms_alpha)
+{
+    size_t lanes = Meter.level.size();
+#ifdef METER_SSE
+    const __m128 decay = _mm_set1_ps(peak_decay);
+    const __m128 alpha = _mm_set1_ps(rms_alpha);
+    const __m128 dt = _mm_set1_ps(dt_ms);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 clip_level = _mm_set1_ps(METER_CLIP_LEVEL);
+    const __m128 clip_hold = _mm_set1_ps(METER_CLIP_HOLD_MS);
+    const __m128 silence_level = _mm_set1_ps(METER_SILENCE_LEVEL);
+    for (size_t i = 0; i < lanes; i += 4)
+    {   __m128 x = _mm_loadu_ps(&Meter.level[i]);
+        __m128 peak = _mm_max_ps(x, _mm_mul_ps(_mm_loadu_ps(&Meter.peak[i]), decay));
+        __m128 ms = _mm_loadu_ps(&Meter.mean_sq[i]);
+        ms = _mm_add_ps(ms, _mm_mul_ps(alpha, _mm_sub_ps(_mm_mul_ps(x, x), ms)));
+        __m128 clip_ms = _mm_loadu_ps(&Meter.clip_ms[i]);
+        __m128 clipped = _mm_cmpge_ps(x, clip_level);
+        // New clips are those not already held
+        int rising = _mm_movemask_ps(_mm_andnot_ps(_mm_cmpgt_ps(clip_ms, zero), clipped));
+        clip_ms = _mm_or_ps(_mm_and_ps(clipped, clip_hold),
+                            _mm_andnot_ps(clipped, _mm_max_ps(_mm_sub_ps(clip_ms, dt), zero)));
+        __m128 quiet = _mm_and_ps(_mm_cmplt_ps(x, silence_level),
+                                  _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)&Meter.rx_mask[i])));
+        __m128 silent_ms = _mm_and_ps(quiet, _mm_add_ps(_mm_loadu_ps(&Meter.silent_ms[i]), dt));
+        _mm_storeu_ps(&Meter.peak[i], peak);
+        _mm_storeu_ps(&Meter.mean_sq[i], ms);
+        _mm_storeu_ps(&Meter.rms[i], _mm_sqrt_ps(ms));
+        _mm_storeu_ps(&Meter.clip_ms[i], clip_ms);
+        _mm_storeu_ps(&Meter.silent_ms[i], silent_ms);
+        if (rising)
+            count_clip(i, rising);
+    }
+#else
+    for (size_t i = 0; i < lanes; i++)
+    {   float x = Meter.level[i];
+        float decayed = Meter.peak[i] * peak_decay;
+        Meter.peak[i] = (x > decayed) ? x : decayed;
+        Meter.mean_sq[i] += rms_alpha * (x * x - Meter.mean_sq[i]);
+        Meter.rms[i] = sqrtf(Meter.mean_sq[i]);
+        int clipped = (x >= METER_CLIP_LEVEL);
+        if (clipped && !(Meter.clip_ms[i] > 0))
+            count_clip(i, 1);
+        float held = Meter.clip_ms[i] - dt_ms;
+        Meter.clip_ms[i] = clipped ? METER_CLIP_HOLD_MS : ((held > 0) ? held : 0);
+        int quiet = (x < METER_SILENCE_LEVEL) && Meter.rx_mask[i];
+        Meter.silent_ms[i] = quiet ? Meter.silent_ms[i] + dt_ms : 0;
+    }
+#endif
+}
+
+static void publish(void)
+{
+    std::shared_ptr<MeterTable> table = std::make_shared<MeterTable>();
+    size_t count = Meter.count;
+    table->level.assign(Meter.level.begin(), Meter.level.begin() + count);
+    table->peak.assign(Meter.peak.begin(), Meter.peak.begin() + count);
+    table->rms.assign(Meter.rms.begin(), Meter.rms.begin() + count);
+    table->clips.assign(Meter.clips.begin(), Meter.clips.begin() + count);
+    table->alarms.resize(count);
+    for (size_t i = 0; i < count; i++)
+        table->alarms[i] = ((Meter.clip_ms[i] > 0) ? METER_CLIPPING : 0) |
+                           ((Meter.silent_ms[i] >= METER_SILENCE_MS) ? METER_SILENT : 0);
+    std::atomic_store(&Published, std::shared_ptr<const MeterTable>(table));
+}
+
+void meter_sample(void)
+{
+    if (!Meter.enabled)
+        return;
+    const DomainCaches& caches = refresh_caches();
+    size_t count = caches.radios->size();
+    if (count != Meter.count)
+    {   for (size_t i = Meter.count; i < count; i++)
+            Radio_SetAudioLevelEnable((int)i, 1);
+        Meter.count = count;
+        resize(count);
+        Meter.flags.reset();
+    }
+    // The receive mask only changes with the polled radio flags
+    if (caches.radio_flags != Meter.flags)
+    {   Meter.flags = caches.radio_flags;
+        for (size_t i = 0; i < count; i++)
+            Meter.rx_mask[i] = ((*Meter.flags)[i] & RADIO_RECEIVING) ? ~0u : 0;
+    }
+    for (size_t i = 0; i < count; i++)
+        Meter.level[i] = Radio_AudioLevel((int)i);
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    float dt_ms = std::chrono::duration<float, std::milli>(now - Meter.last).count();
+    Meter.last = now;
+    kernel(dt_ms, expf(-dt_ms / METER_PEAK_TAU_MS), 1.0f - expf(-dt_ms / METER_RMS_TAU_MS));
+    publish();
+}
+
+std::shared_ptr<const MeterTable> meter_read(void)
+{
+    return std::atomic_load(&Published);
+}
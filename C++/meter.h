@@ -0,0 +1,73 @@
+/*
+ *  Voisus SDK Example audio level meters
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef METER_H
+#define METER_H
+
+#include <memory>
+#include <vector>
+
+/// Meter alarms, see MeterTable::alarms
+enum MeterAlarm_t
+{
+    METER_CLIPPING      = 1 << 0,   ///< Level reached METER_CLIP_LEVEL within METER_CLIP_HOLD_MS
+    METER_SILENT        = 1 << 1    ///< Receiving, but below METER_SILENCE_LEVEL for METER_SILENCE_MS
+};
+
+#define METER_CLIP_LEVEL    0.99f   ///< Level counted as clipping
+#define METER_CLIP_HOLD_MS  1000.0f ///< How long a clip keeps the alarm raised
+#define METER_SILENCE_LEVEL 0.01f   ///< Level counted as silence
+#define METER_SILENCE_MS    2000.0f ///< Silence while receiving that raises the alarm
+#define METER_PEAK_TAU_MS   300.0f  ///< Time constant of the falling peak
+#define METER_RMS_TAU_MS    300.0f  ///< Time constant of the RMS average
+
+/// @brief Audio level meters, one column per field indexed by radio index
+/// @details Levels are 0.0 to 1.0, as returned by Radio_AudioLevel.
+struct MeterTable
+{
+    size_t size(void) const { return level.size(); }
+
+    std::vector<float>          level;      ///< Last sampled level
+    std::vector<float>          peak;       ///< Peak level, decaying over METER_PEAK_TAU_MS
+    std::vector<float>          rms;        ///< RMS level over about METER_RMS_TAU_MS
+    std::vector<unsigned char>  alarms;     ///< ::MeterAlarm_t bits
+    std::vector<unsigned int>   clips;      ///< Clipping events since metering was enabled
+};
+
+/// @brief Enables or disables audio levels on every radio and the metering
+/// @details While enabled, radios added later (e.g. by a role change) are
+/// enabled as they appear.
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+void meter_enable(int enable);
+
+/// @brief Samples every radio's audio level and publishes new meters
+/// @details Called on every update tick. Does nothing while disabled.
+/// @note Must be called from the thread that owns libvrcc.
+void meter_sample(void);
+
+/// @brief Gets the latest meters
+/// @details Safe to call from any thread.
+/// @returns meters, or NULL if metering is disabled
+std::shared_ptr<const MeterTable> meter_read(void);
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ *  Voisus SDK Example net ID index
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "net_index.h"
+#include <mutex>
+#include <unordered_map>
+
+static std::mutex Intern_lock;
+static std::unordered_map<std::string, NetKey> Intern_keys;
+
+NetKey net_intern(const char* id)
+{
+    std::lock_guard<std::mutex> lock(Intern_lock);
+    return Intern_keys.emplace(id, (NetKey)Intern_keys.size()).first->second;
+}
+
+NetKey net_find(const char* id)
+{
+    std::lock_guard<std::mutex> lock(Intern_lock);
+    std::unordered_map<std::string, NetKey>::const_iterator it = Intern_keys.find(id);
+    return (it != Intern_keys.end()) ? it->second : -1;
+}
+
+// Keys are dense, so a multiplicative hash spreads them well enough
+static size_t slot_of(NetKey key, size_t mask)
+{
+    return ((unsigned int)key * 2654435761u) & mask;
+}
+
+void NetIndex::build(const std::vector<NetKey>& keys)
+{
+    size_t size = 4;
+    while (size < keys.size() * 2)
+        size *= 2;
+    Slot empty = {-1, -1};
+    slots.assign(size, empty);
+    for (int i = 0; i < (int)keys.size(); i++)
+    {   size_t s = slot_of(keys[i], size - 1);
+        while ((slots[s].key != -1) && (slots[s].key != keys[i]))
+            s = (s + 1) & (size - 1);
+        // A net listed twice keeps its first index, as a linear scan would
+        if (slots[s].key == -1)
+        {   slots[s].key = keys[i];
+            slots[s].index = i;
+        }
+    }
+}
+
+int NetIndex::find(NetKey key) const
+{
+    if ((key < 0) || slots.empty())
+        return -1;
+    size_t mask = slots.size() - 1;
+    for (size_t s = slot_of(key, mask); slots[s].key != -1; s = (s + 1) & mask)
+    {   if (slots[s].key == key)
+            return slots[s].index;
+    }
+    return -1;
+}
@@ -0,0 +1,70 @@
+/*
+ *  Voisus SDK Example net ID index
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef NET_INDEX_H
+#define NET_INDEX_H
+
+#include <string>
+#include <vector>
+
+/// Interned net ID, equal for equal ID strings, -1 for none
+typedef int NetKey;
+
+/// @brief Interns a net ID
+/// @details Keys are never released, so a key stays valid (and comparable
+/// across radios, jammers and snapshots) for the life of the process.
+/// @note Must be called from the thread that owns libvrcc.
+NetKey net_intern(const char* id);
+
+/// @brief Gets the key of an already interned net ID
+/// @details Safe to call from any thread.
+/// @returns key, or -1 if the ID was never interned
+NetKey net_find(const char* id);
+
+/// @brief Per-radio or per-jammer index from net key to net index
+/// @details Built once per domain refresh. An open-addressing table sized to
+/// at least twice the net count, so lookups probe about one slot.
+class NetIndex
+{
+public:
+    /// @brief Builds the index over the keys of a net list, in net index order
+    void build(const std::vector<NetKey>& keys);
+
+    /// @brief Finds a net by key
+    /// @returns net index, or -1 if the net is not assigned
+    int find(NetKey key) const;
+
+    /// @brief Finds a net by ID
+    /// @returns net index, or -1 if the net is not assigned
+    int find(const char* id) const { return find(net_find(id)); }
+
+private:
+    struct Slot
+    {
+        NetKey key;
+        int index;
+    };
+    std::vector<Slot> slots;
+};
+
+#endif
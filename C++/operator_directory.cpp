@@ -0,0 +1,160 @@
+/*
+ *  Voisus SDK Example columnar operator directory
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "operator_directory.h"
+#include <bitset>
+#include <stdio.h>
+#include <string.h>
+
+static const char* const Field_names[OPERATOR_FIELD_COUNT + OPERATOR_FLAG_COUNT] =
+    {"id", "role", "clientname", "hostname", "clientversion", "serverversion", "connected", "callactive"};
+
+int operator_field(const char* name)
+{
+    for (int f = 0; f < OPERATOR_FIELD_COUNT + OPERATOR_FLAG_COUNT; f++)
+    {   if (!strcmp(name, Field_names[f]))
+            return f;
+    }
+    return -1;
+}
+
+int OperatorTable::find(const char* id) const
+{
+    long long key = lookup(id);
+    return ((key >= 0) && (key < (long long)rows.size())) ? rows[key] : -1;
+}
+
+long long OperatorTable::lookup(const char* text) const
+{
+    std::unordered_map<std::string, OperatorString>::const_iterator it = keys.find(text);
+    return (it != keys.end()) ? (long long)it->second : -1;
+}
+
+OperatorString OperatorTable::intern(const char* text)
+{
+    std::pair<std::unordered_map<std::string, OperatorString>::iterator, bool> added =
+        keys.emplace(text, (OperatorString)strings.size());
+    if (added.second)
+        strings.push_back(text);
+    return added.first->second;
+}
+
+void OperatorTable::add(const OperatorString fields[OPERATOR_FIELD_COUNT], const int flag_values[OPERATOR_FLAG_COUNT])
+{
+    for (int f = 0; f < OPERATOR_FIELD_COUNT; f++)
+        columns[f].push_back(fields[f]);
+    if (rows.size() <= fields[OPERATOR_ID])
+        rows.resize(fields[OPERATOR_ID] + 1, -1);
+    rows[fields[OPERATOR_ID]] = (int)count;
+    for (int f = 0; f < OPERATOR_FLAG_COUNT; f++)
+    {   if (0 == (count & 63))
+            flags[f].push_back(0);
+        if (flag_values[f])
+            flags[f][count >> 6] |= 1ull << (count & 63);
+    }
+    count++;
+}
+
+// Trims spaces and tabs from both ends in place
+static char* trim(char* text)
+{
+    text += strspn(text, " \t");
+    size_t len = strlen(text);
+    while (len && strchr(" \t", text[len - 1]))
+        text[--len] = '\0';
+    return text;
+}
+
+int OperatorFilter::parse(const char* text, char* error, size_t errsz)
+{
+    terms.clear();
+    std::string all = text;
+    if (!all[strspn(all.c_str(), " \t")])
+        return 1;
+    for (size_t pos = 0; pos <= all.size(); )
+    {   size_t end = all.find("&&", pos);
+        if (end == std::string::npos)
+            end = all.size();
+        std::string part = all.substr(pos, end - pos);
+        pos = end + 2;
+        char* term_text = trim(&part[0]);
+        if (!*term_text)
+        {   snprintf(error, errsz, "empty term");
+            return 0;
+        }
+        Term term;
+        term.negate = 0;
+        char* value = strchr(term_text, '=');
+        if (value)
+        {   term.negate = (value > term_text) && ('!' == value[-1]);
+            value[term.negate ? -1 : 0] = '\0';
+            term.value = trim(value + 1);
+            term.field = operator_field(trim(term_text));
+            if ((term.field < 0) || (term.field >= OPERATOR_FIELD_COUNT))
+            {   snprintf(error, errsz, "no field %s", trim(term_text));
+                return 0;
+            }
+        }
+        else
+        {   term.negate = ('!' == *term_text);
+            const char* name = trim(term_text + term.negate);
+            term.field = operator_field(name);
+            if (term.field < OPERATOR_FIELD_COUNT)
+            {   snprintf(error, errsz, "%s is not connected or callactive", name);
+                return 0;
+            }
+        }
+        terms.push_back(term);
+    }
+    return 1;
+}
+
+size_t OperatorFilter::match(const OperatorTable& table, std::vector<uint64_t>& mask) const
+{
+    size_t words = (table.size() + 63) >> 6;
+    mask.assign(words, ~0ull);
+    if (table.size() & 63)
+        mask[words - 1] = (1ull << (table.size() & 63)) - 1;
+    std::vector<uint64_t> bits;
+    for (size_t t = 0; t < terms.size(); t++)
+    {   const Term& term = terms[t];
+        if (term.field >= OPERATOR_FIELD_COUNT)
+        {   const std::vector<uint64_t>& flag = table.flags[term.field - OPERATOR_FIELD_COUNT];
+            for (size_t w = 0; w < words; w++)
+                mask[w] &= term.negate ? ~flag[w] : flag[w];
+            continue;
+        }
+        // A value no operator has matches nothing, or everything when negated
+        long long key = table.lookup(term.value.c_str());
+        const std::vector<OperatorString>& column = table.columns[term.field];
+        bits.assign(words, 0);
+        for (size_t op = 0; (key >= 0) && (op < table.size()); op++)
+            bits[op >> 6] |= (uint64_t)(column[op] == (OperatorString)key) << (op & 63);
+        for (size_t w = 0; w < words; w++)
+            mask[w] &= term.negate ? ~bits[w] : bits[w];
+    }
+    size_t matches = 0;
+    for (size_t w = 0; w < words; w++)
+        matches += std::bitset<64>(mask[w]).count();
+    return matches;
+}
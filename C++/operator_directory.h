@@ -0,0 +1,133 @@
+/*
+ *  Voisus SDK Example columnar operator directory
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef OPERATOR_DIRECTORY_H
+#define OPERATOR_DIRECTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// String fields of an operator (see Operator_GetField)
+enum OperatorField_t
+{
+    OPERATOR_ID,                    ///< Unique ID of the operator
+    OPERATOR_ROLE,                  ///< Role name
+    OPERATOR_CLIENTNAME,            ///< Client name
+    OPERATOR_HOSTNAME,              ///< Server the client is connected to
+    OPERATOR_CLIENTVERSION,         ///< Version of client
+    OPERATOR_SERVERVERSION,         ///< Version of server
+    OPERATOR_FIELD_COUNT
+};
+
+/// Yes/no fields of an operator, reported as "true" or "false"
+enum OperatorFlag_t
+{
+    OPERATOR_CONNECTED,             ///< Client is connected
+    OPERATOR_CALLACTIVE,            ///< Client is on a call
+    OPERATOR_FLAG_COUNT
+};
+
+/// Interned string, an index into OperatorTable::strings
+typedef unsigned int OperatorString;
+
+/// @brief Every operator, one column per field indexed by operator index
+/// @details Rebuilt only when Operator_Version moves. Roles, hosts and
+/// versions repeat across hundreds of operators, so every string field is
+/// interned once per table and stored as an index; the yes/no fields are
+/// bitsets, 64 operators per word, for OperatorFilter.
+struct OperatorTable
+{
+    OperatorTable() : count(0) {}
+
+    size_t size(void) const { return count; }
+    bool empty(void) const { return !count; }
+
+    /// @brief Gets a string field of an operator
+    const std::string& field(int field, size_t op) const { return strings[columns[field][op]]; }
+
+    /// @brief Gets a yes/no field of an operator
+    int flag(int flag, size_t op) const { return (int)((flags[flag][op >> 6] >> (op & 63)) & 1); }
+
+    /// @brief Finds an operator by ID with one hash lookup
+    /// @returns operator index, or -1 if there is no such operator
+    int find(const char* id) const;
+
+    /// @brief Gets the interned index of a string
+    /// @returns index, or -1 if no operator has that value in any field
+    long long lookup(const char* text) const;
+
+    /// @brief Interns a string, adding it to the pool if it is new
+    OperatorString intern(const char* text);
+
+    /// @brief Appends an operator
+    /// @param fields ::OperatorField_t values, as returned by intern()
+    /// @param flag_values ::OperatorFlag_t values
+    void add(const OperatorString fields[OPERATOR_FIELD_COUNT], const int flag_values[OPERATOR_FLAG_COUNT]);
+
+    size_t count;
+    std::vector<OperatorString> columns[OPERATOR_FIELD_COUNT];
+    std::vector<uint64_t> flags[OPERATOR_FLAG_COUNT];
+    std::vector<std::string> strings;       ///< Interned values
+    std::unordered_map<std::string, OperatorString> keys;   ///< Value to index in strings
+    std::vector<int> rows;                  ///< Interned ID to operator index, -1 for other strings
+};
+
+/// @brief Names the string field or yes/no field of an operator
+/// @returns ::OperatorField_t, or OPERATOR_FIELD_COUNT + ::OperatorFlag_t, or -1
+int operator_field(const char* name);
+
+/// @brief Conjunction of conditions on operator fields, evaluated as bitmasks
+/// @details Terms are joined by "&&":
+///
+///     connected && !callactive && role=Pilot 1 && hostname!=voisus-0
+///
+/// A flag term takes one AND (or AND NOT) of its bitset per 64 operators;
+/// a field term turns the value into its interned index once and compares
+/// indexes down the column.
+class OperatorFilter
+{
+public:
+    /// @brief Parses a filter; an empty text matches every operator
+    /// @param error Receives a message when the filter is rejected
+    /// @returns 1 on success, 0 on error
+    int parse(const char* text, char* error, size_t errsz);
+
+    /// @brief Finds the matching operators
+    /// @param mask Receives one bit per operator, set if it matches
+    /// @returns count of matches
+    size_t match(const OperatorTable& table, std::vector<uint64_t>& mask) const;
+
+private:
+    struct Term
+    {
+        int field;                  // As returned by operator_field()
+        int negate;
+        std::string value;          // Empty for a flag
+    };
+    std::vector<Term> terms;
+};
+
+#endif
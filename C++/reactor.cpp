@@ -0,0 +1,223 @@
+/*
+ *  Voisus SDK Example event reactor
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "reactor.h"
+#include <stdio.h>
+#include <stdint.h>
+#ifdef WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #include <winsock2.h>
+#else
+    #include <unistd.h>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/timerfd.h>
+#endif
+
+Reactor::Reactor(unsigned int min_ms, unsigned int max_ms)
+    : min_ms(min_ms),
+      max_ms(max_ms),
+      interval_ms(min_ms),
+      running(0),
+      input_fd(-1),
+      input_func(NULL),
+      tick_func(NULL),
+      wake_func(NULL),
+      deadline_func(NULL)
+{
+#ifndef WIN32
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = timer_fd;
+    int ok = (-1 != epoll_fd) && (-1 != timer_fd) && (-1 != wake_fd) &&
+             (-1 != epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &ev));
+    ev.data.fd = wake_fd;
+    if (!ok || (-1 == epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &ev)))
+        perror("reactor");
+#else
+    wake_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+#endif
+}
+
+Reactor::~Reactor()
+{
+#ifndef WIN32
+    close(wake_fd);
+    close(timer_fd);
+    close(epoll_fd);
+#else
+    CloseHandle(wake_event);
+#endif
+}
+
+int Reactor::add_input(int fd, reactor_input_func func)
+{
+#ifndef WIN32
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (-1 == epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev))
+    {   perror("reactor");
+        return 0;
+    }
+#endif
+    input_fd = fd;
+    input_func = func;
+    return 1;
+}
+
+void Reactor::set_tick(reactor_tick_func func)
+{
+    tick_func = func;
+}
+
+void Reactor::set_wake(reactor_input_func func)
+{
+    wake_func = func;
+}
+
+void Reactor::set_deadline(reactor_deadline_func func)
+{
+    deadline_func = func;
+}
+
+unsigned int Reactor::next_ms(void) const
+{
+    long long deadline_ms = deadline_func ? deadline_func() : -1;
+    if ((deadline_ms >= 0) && (deadline_ms < interval_ms))
+        return (unsigned int)deadline_ms;
+    return interval_ms;
+}
+
+void Reactor::kick(void)
+{
+    interval_ms = min_ms;
+    arm_timer();
+}
+
+void Reactor::stop(void)
+{
+    running = 0;
+}
+
+void Reactor::tick(void)
+{
+    if (tick_func && tick_func())
+        interval_ms = min_ms;
+    else if (interval_ms < max_ms)
+        interval_ms = (interval_ms * 2 < max_ms) ? interval_ms * 2 : max_ms;
+    arm_timer();
+}
+
+#ifndef WIN32
+
+void Reactor::wake(void)
+{
+    uint64_t one = 1;
+    if (write(wake_fd, &one, sizeof(one)) < 0)
+        perror("reactor");
+}
+
+void Reactor::arm_timer(void)
+{
+    if (!tick_func)
+        return;
+    unsigned int ms = next_ms();
+    struct itimerspec its = {};
+    its.it_value.tv_sec = ms / 1000;
+    its.it_value.tv_nsec = (ms % 1000) * 1000000L;
+    if (!ms)
+        its.it_value.tv_nsec = 1;           // A zero value would disarm
+    timerfd_settime(timer_fd, 0, &its, NULL);
+}
+
+void Reactor::run(void)
+{
+    struct epoll_event events[4];
+    running = 1;
+    arm_timer();
+    while (running)
+    {   int n = epoll_wait(epoll_fd, events, 4, -1);
+        for (int i = 0; running && (i < n); i++)
+        {   uint64_t count;
+            if (events[i].data.fd == timer_fd)
+            {   if (read(timer_fd, &count, sizeof(count)) > 0)
+                    tick();
+            }
+            else if (events[i].data.fd == wake_fd)
+            {   if ((read(wake_fd, &count, sizeof(count)) > 0) && wake_func)
+                {   wake_func();
+                    kick();
+                }
+            }
+            else if ((events[i].data.fd == input_fd) && input_func)
+            {   input_func();
+                kick();
+            }
+        }
+    }
+}
+
+#else
+
+void Reactor::wake(void)
+{
+    SetEvent(wake_event);
+}
+
+void Reactor::arm_timer(void)
+{
+    deadline = GetTickCount64() + next_ms();
+}
+
+void Reactor::run(void)
+{
+    HANDLE handles[] = {wake_event, GetStdHandle(STD_INPUT_HANDLE)};
+    DWORD count = input_func ? 2 : 1;
+    running = 1;
+    arm_timer();
+    while (running)
+    {   DWORD timeout = WSA_INFINITE;
+        if (tick_func)
+        {   ULONGLONG now = GetTickCount64();
+            timeout = (now < deadline) ? (DWORD)(deadline - now) : 0;
+        }
+        DWORD result = WSAWaitForMultipleEvents(count, handles, FALSE, timeout, TRUE);
+        if ((WSA_WAIT_EVENT_0 == result) && wake_func)
+        {   wake_func();
+            kick();
+        }
+        else if ((WSA_WAIT_EVENT_0 + 1 == result) && input_func)
+        {   input_func();
+            kick();
+        }
+        else if (tick_func && (GetTickCount64() >= deadline))
+            tick();
+    }
+}
+
+#endif
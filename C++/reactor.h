@@ -0,0 +1,105 @@
+/*
+ *  Voisus SDK Example event reactor
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef REACTOR_H
+#define REACTOR_H
+
+/// Called when a watched descriptor becomes readable
+typedef void (*reactor_input_func)(void);
+
+/// Called on every tick, returns 1 if state changed (see VRCC_Update)
+typedef int (*reactor_tick_func)(void);
+
+/// Returns ms until something needs a tick, -1 for no deadline
+typedef long long (*reactor_deadline_func)(void);
+
+/// @brief Single-threaded event loop multiplexing input and an update tick
+/// @details On Linux the loop sleeps in epoll_wait on the input descriptor,
+/// an eventfd used by wake() and a timerfd, so it only wakes when there is
+/// something to do. The tick interval is adaptive: it drops to min_ms whenever
+/// the tick reports a change, input arrives or the loop is woken, and doubles
+/// on every idle tick up to max_ms. A deadline function can bring the next
+/// tick forward, to the millisecond, for timers that cannot wait.
+/// On Windows the loop waits on the console input handle and a wake event
+/// with a timeout.
+class Reactor
+{
+public:
+    Reactor(unsigned int min_ms = 0, unsigned int max_ms = 0);
+    ~Reactor();
+
+    /// @brief Watch a descriptor for input
+    /// @note On Windows only the standard input descriptor is supported.
+    /// @returns 1 on success, 0 on error
+    int add_input(int fd, reactor_input_func func);
+
+    /// @brief Set the function called on every tick
+    /// @details Without a tick function the loop only waits for input and wakes.
+    void set_tick(reactor_tick_func func);
+
+    /// @brief Set the function called on the loop thread after wake()
+    void set_wake(reactor_input_func func);
+
+    /// @brief Set the function asked for the next deadline when arming a tick
+    void set_deadline(reactor_deadline_func func);
+
+    /// @brief Wake the loop from any thread
+    void wake(void);
+
+    /// @brief Reset the tick interval to its minimum (e.g. after user activity)
+    void kick(void);
+
+    /// @brief Gets the current tick interval
+    unsigned int interval(void) const { return interval_ms; }
+
+    /// @brief Run the loop until stop() is called
+    void run(void);
+
+    /// @brief Stop the loop after the current event is handled
+    void stop(void);
+
+private:
+    void tick(void);
+    void arm_timer(void);
+    unsigned int next_ms(void) const;
+
+    unsigned int min_ms;
+    unsigned int max_ms;
+    unsigned int interval_ms;
+    int running;
+    int input_fd;
+    reactor_input_func input_func;
+    reactor_tick_func tick_func;
+    reactor_input_func wake_func;
+    reactor_deadline_func deadline_func;
+#ifndef WIN32
+    int epoll_fd;
+    int timer_fd;
+    int wake_fd;
+#else
+    unsigned long long deadline;
+    void* wake_event;
+#endif
+};
+
+#endif
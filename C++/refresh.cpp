@@ -0,0 +1,414 @@
+/*
+ *  Voisus SDK Example version-driven refresh engine
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "refresh.h"
+#include "activity.h"
+#include "vrcc_timed.h"
+#include <atomic>
+#include <string.h>
+
+typedef struct {
+    const char* name;
+    int (*version)(void);
+    void (*refresh)(DomainCaches& caches);
+} DOMAIN_T;
+
+static void refresh_connection(DomainCaches& caches)
+{
+    std::shared_ptr<ConnectionInfo> conn = std::make_shared<ConnectionInfo>();
+    conn->target_ip = Network_TargetIP();
+    conn->client_name = Network_ClientName();
+    conn->role_name_active = Role_NameActive();
+    conn->connect_state = Network_ConnectState();
+    conn->connection_status = Network_ConnectionStatus();
+    conn->ptt_pressed = PTT_GetPressed();
+    caches.connection = conn;
+}
+
+static void poll_radio_flags(size_t count, std::vector<unsigned char>& flags)
+{
+    flags.resize(count);
+    for (int i = 0; i < (int)count; i++)
+    {   flags[i] = (Radio_IsTransmitEnabled(i) ? RADIO_TX_ENABLED : 0) |
+                   (Radio_IsReceiveEnabled(i) ? RADIO_RX_ENABLED : 0) |
+                   (Radio_IsReceiving(i) ? RADIO_RECEIVING : 0) |
+                   (Radio_IsTransmitting(i) ? RADIO_TRANSMITTING : 0);
+    }
+}
+
+static void refresh_radios(DomainCaches& caches)
+{
+    std::shared_ptr<RadioTable> radios = std::make_shared<RadioTable>();
+    RadioTable& table = *radios;
+    size_t count = Radio_ListCount();
+    table.name.resize(count);
+    table.type.resize(count);
+    table.net_id_active.resize(count);
+    table.net_name_active.resize(count);
+    table.effects.resize(count);
+    table.volume.resize(count);
+    table.volume_left.resize(count);
+    table.volume_right.resize(count);
+    table.balance.resize(count);
+    table.ptt.resize(count);
+    table.locks.resize(count);
+    table.nets.resize(count);
+    table.net_index.resize(count);
+    table.net_active.resize(count);
+    table.rx_frequency.resize(count);
+    table.tx_frequency.resize(count);
+    for (int i = 0; i < (int)count; i++)
+    {   table.name[i] = Radio_Name(i);
+        table.type[i] = Radio_Type(i);
+        table.net_id_active[i] = Radio_NetIDActive(i);
+        table.net_name_active[i] = Radio_NetNameActive(i);
+        table.effects[i] = Radio_RadioEffects(i);
+        table.volume[i] = Radio_Volume(i);
+        table.volume_left[i] = Radio_VolumeStereoLeft(i);
+        table.volume_right[i] = Radio_VolumeStereoRight(i);
+        table.balance[i] = Radio_Balance(i);
+        table.ptt[i] = Radio_PTT(i);
+        table.locks[i] = (Radio_IsNetLocked(i) ? RADIO_LOCK_NET : 0) |
+                         (Radio_IsRXModeLocked(i) ? RADIO_LOCK_RX_MODE : 0) |
+                         (Radio_IsTXModeLocked(i) ? RADIO_LOCK_TX_MODE : 0) |
+                         (Radio_BalanceLocked(i) ? RADIO_LOCK_BALANCE : 0) |
+                         (Radio_RadioEffectsLocked(i) ? RADIO_LOCK_EFFECTS : 0) |
+                         (Radio_PlaysoundLocked(i) ? RADIO_LOCK_PLAYSOUND : 0);
+        std::vector<NetInfo>& nets = table.nets[i];
+        nets.resize(Radio_NetListCount(i));
+        std::vector<NetKey> keys(nets.size());
+        for (int n = 0; n < (int)nets.size(); n++)
+        {   NetInfo& net = nets[n];
+            net.id = Radio_NetID(i, n);
+            net.key = keys[n] = net_intern(net.id.c_str());
+            net.name = Radio_NetName(i, n);
+            net.waveform = Radio_NetWaveform(i, n);
+            net.frequency = Radio_NetFrequency(i, n);
+            net.crypto_enabled = Radio_NetCryptoEnabled(i, n);
+        }
+        table.net_index[i].build(keys);
+        table.net_active[i] = table.net_index[i].find(net_intern(table.net_id_active[i].c_str()));
+        table.rx_frequency[i] = Radio_NetRxFrequencyActive(i);
+        table.tx_frequency[i] = Radio_NetTxFrequencyActive(i);
+        for (int n = 0; n < (int)nets.size(); n++)
+            table.frequencies.add(nets[n].frequency, i, n, FREQ_NET);
+        table.frequencies.add(table.rx_frequency[i], i, table.net_active[i], FREQ_RX_ACTIVE);
+        table.frequencies.add(table.tx_frequency[i], i, table.net_active[i], FREQ_TX_ACTIVE);
+    }
+    table.frequencies.sort();
+    caches.radios = radios;
+    std::shared_ptr<std::vector<unsigned char> > flags = std::make_shared<std::vector<unsigned char> >();
+    poll_radio_flags(count, *flags);
+    caches.radio_flags = flags;
+}
+
+// Publishes new radio flags if any changed since the table was built.
+// Polled into a scratch vector so that a quiet tick allocates nothing.
+static int refresh_radio_flags(DomainCaches& caches)
+{
+    static std::vector<unsigned char> Scratch;
+    poll_radio_flags(caches.radios->size(), Scratch);
+    if (Scratch == *caches.radio_flags)
+        return 0;
+    std::shared_ptr<std::vector<unsigned char> > flags = std::make_shared<std::vector<unsigned char> >();
+    flags->swap(Scratch);
+    caches.radio_flags = flags;
+    return 1;
+}
+
+static void refresh_jammers(DomainCaches& caches)
+{
+    std::shared_ptr<std::vector<JammerInfo> > jammers =
+        std::make_shared<std::vector<JammerInfo> >(Jammer_ListCount());
+    for (int i = 0; i < (int)jammers->size(); i++)
+    {   JammerInfo& jammer = (*jammers)[i];
+        jammer.net_id_active = Jammer_NetIDActive(i);
+        jammer.transmitting = Jammer_IsTransmitting(i);
+        jammer.state = Jammer_RecordReplayState(i);
+        jammer.progress = Jammer_RecordReplayProgress(i);
+        jammer.duration_ms = Jammer_RecordReplayDurationMs(i);
+        jammer.nets.resize(Jammer_NetListCount(i));
+        std::vector<NetKey> keys(jammer.nets.size());
+        for (int n = 0; n < (int)jammer.nets.size(); n++)
+        {   jammer.nets[n].id = Jammer_NetID(i, n);
+            jammer.nets[n].key = keys[n] = net_intern(jammer.nets[n].id.c_str());
+            jammer.nets[n].name = Jammer_NetName(i, n);
+        }
+        jammer.net_index.build(keys);
+        jammer.net_active = jammer.net_index.find(net_intern(jammer.net_id_active.c_str()));
+    }
+    caches.jammers = jammers;
+}
+
+static void refresh_roles(DomainCaches& caches)
+{
+    std::shared_ptr<std::vector<NamedInfo> > roles =
+        std::make_shared<std::vector<NamedInfo> >(Role_ListCount());
+    for (int i = 0; i < (int)roles->size(); i++)
+    {   (*roles)[i].id = Role_Id(i);
+        (*roles)[i].name = Role_Name(i);
+    }
+    caches.roles = roles;
+}
+
+static void refresh_entity_states(DomainCaches& caches)
+{
+    std::shared_ptr<std::vector<NamedInfo> > states =
+        std::make_shared<std::vector<NamedInfo> >(EntityState_ListCount());
+    for (int i = 0; i < (int)states->size(); i++)
+    {   (*states)[i].id = EntityState_Id(i);
+        (*states)[i].name = EntityState_Name(i);
+    }
+    caches.entity_states = states;
+}
+
+static void refresh_operators(DomainCaches& caches)
+{
+    static const char* const Fields[OPERATOR_FIELD_COUNT] =
+        {NULL, "role", "clientname", "hostname", "clientversion", "serverversion"};
+    static const char* const Flags[OPERATOR_FLAG_COUNT] = {"connected", "callactive"};
+    std::shared_ptr<OperatorTable> operators = std::make_shared<OperatorTable>();
+    OperatorString fields[OPERATOR_FIELD_COUNT];
+    int flags[OPERATOR_FLAG_COUNT];
+    std::string uuid;
+    Operator_GetLock();
+    for (const char* id = Operator_IDFirst(); strlen(id); id = Operator_IDNext())
+    {   // Values point into libvrcc buffers, so each is interned before the
+        // next call; the ID is copied since interning may move the pool
+        uuid = id;
+        fields[OPERATOR_ID] = operators->intern(uuid.c_str());
+        for (int f = OPERATOR_ID + 1; f < OPERATOR_FIELD_COUNT; f++)
+            fields[f] = operators->intern(Operator_GetField(uuid.c_str(), Fields[f]));
+        for (int f = 0; f < OPERATOR_FLAG_COUNT; f++)
+            flags[f] = !strcmp(Operator_GetField(uuid.c_str(), Flags[f]), "true");
+        operators->add(fields, flags);
+    }
+    Operator_ReleaseLock();
+    caches.operators = operators;
+}
+
+const CallInfo* CallTable::find(const char* call_id) const
+{
+    CallKey key;
+    call_key(call_id, key);
+    int c = index.find_call(key);
+    return (c >= 0) ? &calls[c] : NULL;
+}
+
+int CallTable::endpoint_state(const char* call_id, const char* endpoint_id) const
+{
+    CallKey call, endpoint;
+    call_key(call_id, call);
+    call_key(endpoint_id, endpoint);
+    int c;
+    int e = index.find_endpoint(call, endpoint, c);
+    return (e >= 0) ? calls[c].endpoints[e].state : -1;
+}
+
+// One walk of the call iterators per Call_Endpoint_Version change
+static void refresh_calls(DomainCaches& caches)
+{
+    std::shared_ptr<CallTable> table = std::make_shared<CallTable>();
+    std::vector<CallInfo>& calls = table->calls;
+    size_t entries = 0;
+    Call_GetLock();
+    for (const char* id = Call_IDFirst(); strlen(id); id = Call_IDNext())
+    {   calls.push_back(CallInfo());
+        CallInfo& call = calls.back();
+        call.id = id;
+        call_key(id, call.key);
+        const char* call_id = call.id.c_str();
+        for (const char* ep = Call_Endpoint_IDFirst(call_id); strlen(ep);
+             ep = Call_Endpoint_IDNext(call_id))
+        {   EndpointInfo endpoint;
+            endpoint.id = ep;
+            call_key(ep, endpoint.key);
+            endpoint.state = Call_Endpoint_State(call_id, endpoint.id.c_str());
+            call.endpoints.push_back(endpoint);
+        }
+        entries += 1 + call.endpoints.size();
+    }
+    Call_ReleaseLock();
+    table->index.reset(entries);
+    for (int c = 0; c < (int)calls.size(); c++)
+    {   table->index.add_call(calls[c].key, c);
+        for (int e = 0; e < (int)calls[c].endpoints.size(); e++)
+            table->index.add_endpoint(calls[c].key, calls[c].endpoints[e].key, c, e);
+    }
+    caches.calls = table;
+}
+
+static void refresh_invitations(DomainCaches& caches)
+{
+    std::shared_ptr<std::vector<InvitationInfo> > invitations =
+        std::make_shared<std::vector<InvitationInfo> >();
+    CallInvitation_t invite;
+    for (int found = Call_Invitation_First(&invite); found;
+         found = Call_Invitation_Next(&invite))
+    {   InvitationInfo info;
+        info.call_id = invite.call_id;
+        info.endpoint_id = invite.endpoint_id;
+        invitations->push_back(info);
+    }
+    caches.invitations = invitations;
+}
+
+static void refresh_clouds(DomainCaches& caches)
+{
+    std::shared_ptr<std::vector<CloudInfo> > clouds =
+        std::make_shared<std::vector<CloudInfo> >();
+    Cloud_GetLock();
+    for (const char* id = Cloud_IDFirst(); strlen(id); id = Cloud_IDNext())
+    {   CloudInfo cloud;
+        cloud.id = id;
+        cloud.server_count = Cloud_GetServerCount(cloud.id.c_str());
+        clouds->push_back(cloud);
+    }
+    Cloud_ReleaseLock();
+    caches.clouds = clouds;
+}
+
+static void refresh_radio_effects(DomainCaches& caches)
+{
+    std::shared_ptr<std::vector<NamedInfo> > effects =
+        std::make_shared<std::vector<NamedInfo> >();
+    for (const char* id = RadioEffects_IDFirst(); strlen(id); id = RadioEffects_IDNext())
+    {   NamedInfo effect;
+        effect.id = id;
+        effect.name = RadioEffects_Name(effect.id.c_str());
+        effects->push_back(effect);
+    }
+    caches.radio_effects = effects;
+}
+
+static void refresh_audio_devices(DomainCaches& caches)
+{
+    static const AudioDeviceType_t types[] = {AUDIO_DEVICE_PLAYBACK,
+                                              AUDIO_DEVICE_CAPTURE,
+                                              AUDIO_DEVICE_PLAYBACK2};
+    std::shared_ptr<std::vector<AudioDeviceInfo> > devices =
+        std::make_shared<std::vector<AudioDeviceInfo> >();
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++)
+    {   std::string active = AudioDevice_IDActive(types[t]);
+        for (const char* id = AudioDevice_IDFirst(types[t]); strlen(id);
+             id = AudioDevice_IDNext(types[t]))
+        {   AudioDeviceInfo device;
+            device.type = types[t];
+            device.id = id;
+            device.name = AudioDevice_Name(types[t], device.id.c_str());
+            device.active = (device.id == active);
+            devices->push_back(device);
+        }
+    }
+    caches.audio_devices = devices;
+}
+
+static void refresh_playsounds(DomainCaches& caches)
+{
+    std::shared_ptr<std::vector<NamedInfo> > playsounds =
+        std::make_shared<std::vector<NamedInfo> >(Playsound_ListCount());
+    for (int i = 0; i < (int)playsounds->size(); i++)
+    {   (*playsounds)[i].id = Playsound_Id(i);
+        (*playsounds)[i].name = Playsound_Name((*playsounds)[i].id.c_str());
+    }
+    caches.playsounds = playsounds;
+}
+
+// Indexed by Domain_t. Version functions are called through lambdas so that
+// vrcc_timed.h can record them.
+static const DOMAIN_T Domains[DOMAIN_COUNT] = {
+    {"connection", NULL, refresh_connection},
+    {"radio", [] { return Radio_Version(); }, refresh_radios},
+    {"jammer", [] { return Jammer_Version(); }, refresh_jammers},
+    {"role", [] { return Role_Version(); }, refresh_roles},
+    {"entitystate", [] { return EntityState_Version(); }, refresh_entity_states},
+    {"operator", [] { return Operator_Version(); }, refresh_operators},
+    {"call", [] { return Call_Endpoint_Version(); }, refresh_calls},
+    {"invitation", [] { return Call_Invitation_Version(); }, refresh_invitations},
+    {"cloud", [] { return Cloud_Version(); }, refresh_clouds},
+    {"radioeffects", [] { return RadioEffects_Version(); }, refresh_radio_effects},
+    {"audiodevice", [] { return AudioDevice_Version(); }, refresh_audio_devices},
+    {"playsound", [] { return Playsound_Version(); }, refresh_playsounds}};
+
+static DomainCaches Caches;
+static int Versions[DOMAIN_COUNT];
+static std::atomic<unsigned long> Counts[DOMAIN_COUNT];
+static int Initialized;
+static int Connection_stale;
+
+unsigned int refresh_update(int update_changed)
+{
+    unsigned int stale = 0;
+    if (!Initialized || update_changed || Connection_stale)
+        stale |= 1 << DOMAIN_CONNECTION;
+    for (int d = 0; d < DOMAIN_COUNT; d++)
+    {   if (!Domains[d].version)
+            continue;
+        int version = Domains[d].version();
+        if (!Initialized || (version != Versions[d]))
+            stale |= 1 << d;
+        Versions[d] = version;
+    }
+
+    if (stale & (1 << DOMAIN_CONNECTION))
+    {   int connect_state = Initialized ? Caches.connection->connect_state : -1;
+        refresh_connection(Caches);
+        Counts[DOMAIN_CONNECTION].fetch_add(1, std::memory_order_relaxed);
+        // Counters may restart with a new connection, so trust none of them
+        if (Caches.connection->connect_state != connect_state)
+            stale = (1 << DOMAIN_COUNT) - 1;
+    }
+    for (int d = DOMAIN_CONNECTION + 1; d < DOMAIN_COUNT; d++)
+    {   if (stale & (1 << d))
+        {   Domains[d].refresh(Caches);
+            Counts[d].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    // Audio activity does not move Radio_Version, so poll it every tick
+    if (!(stale & (1 << DOMAIN_RADIO)) && refresh_radio_flags(Caches))
+        stale |= REFRESH_RADIO_FLAGS;
+    activity_sample(Caches.radio_flags);
+    Initialized = 1;
+    Connection_stale = 0;
+    return stale;
+}
+
+void refresh_invalidate_connection(void)
+{
+    Connection_stale = 1;
+}
+
+const DomainCaches& refresh_caches(void)
+{
+    return Caches;
+}
+
+const char* refresh_domain_name(int domain)
+{
+    return ((domain >= 0) && (domain < DOMAIN_COUNT)) ? Domains[domain].name : "";
+}
+
+unsigned long refresh_count(int domain)
+{
+    return ((domain >= 0) && (domain < DOMAIN_COUNT)) ? Counts[domain].load(std::memory_order_relaxed) : 0;
+}
@@ -0,0 +1,262 @@
+/*
+ *  Voisus SDK Example version-driven refresh engine
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef REFRESH_H
+#define REFRESH_H
+
+#include "call_index.h"
+#include "freq_index.h"
+#include "net_index.h"
+#include "operator_directory.h"
+#include "vrc_types.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+/// State domains, each refreshed as a whole when its version counter moves
+enum Domain_t
+{
+    DOMAIN_CONNECTION,              ///< No counter, refreshed when VRCC_Update() reports a change
+    DOMAIN_RADIO,                   ///< Radio_Version
+    DOMAIN_JAMMER,                  ///< Jammer_Version
+    DOMAIN_ROLE,                    ///< Role_Version
+    DOMAIN_ENTITYSTATE,             ///< EntityState_Version
+    DOMAIN_OPERATOR,                ///< Operator_Version
+    DOMAIN_CALL,                    ///< Call_Endpoint_Version
+    DOMAIN_INVITATION,              ///< Call_Invitation_Version
+    DOMAIN_CLOUD,                   ///< Cloud_Version
+    DOMAIN_RADIOEFFECTS,            ///< RadioEffects_Version
+    DOMAIN_AUDIODEVICE,             ///< AudioDevice_Version
+    DOMAIN_PLAYSOUND,               ///< Playsound_Version
+    DOMAIN_COUNT
+};
+
+/// Connection state
+struct ConnectionInfo
+{
+    std::string         target_ip;          ///< Voisus server address
+    std::string         client_name;        ///< Client name
+    std::string         role_name_active;   ///< Name of the connected role
+    int                 connect_state;      ///< ::ConnectState_t
+    int                 connection_status;  ///< ::ConnectionStatus_t
+    int                 ptt_pressed;        ///< 1 if PTT is pressed
+};
+
+/// Net assigned to a radio
+struct NetInfo
+{
+    std::string         id;                 ///< Unique ID of the net
+    NetKey              key;                ///< Interned ID
+    std::string         name;               ///< Name of the net
+    std::string         waveform;           ///< Waveform name
+    unsigned long long  frequency;          ///< Frequency in Hz
+    int                 crypto_enabled;     ///< 1 if crypto is enabled
+};
+
+/// Per-radio flags polled on every tick, see DomainCaches::radio_flags
+enum RadioFlag_t
+{
+    RADIO_TX_ENABLED    = 1 << 0,   ///< Transmit is enabled
+    RADIO_RX_ENABLED    = 1 << 1,   ///< Receive is enabled
+    RADIO_RECEIVING     = 1 << 2,   ///< Receiving audio
+    RADIO_TRANSMITTING  = 1 << 3    ///< Transmitting audio
+};
+
+/// Per-radio settings locked by the role, see RadioTable::locks
+enum RadioLock_t
+{
+    RADIO_LOCK_NET      = 1 << 0,   ///< Net cannot be changed
+    RADIO_LOCK_RX_MODE  = 1 << 1,   ///< Receive enable cannot be changed
+    RADIO_LOCK_TX_MODE  = 1 << 2,   ///< Transmit enable cannot be changed
+    RADIO_LOCK_BALANCE  = 1 << 3,   ///< Balance cannot be changed
+    RADIO_LOCK_EFFECTS  = 1 << 4,   ///< Radio effects cannot be changed
+    RADIO_LOCK_PLAYSOUND = 1 << 5   ///< Playsound cannot be changed
+};
+
+/// @brief Radio state, one column per field indexed by radio index
+/// @details Rebuilt only when Radio_Version moves. The transmit/receive
+/// flags, which change with audio activity, are kept apart in
+/// DomainCaches::radio_flags so that polling them does not copy the table.
+struct RadioTable
+{
+    size_t size(void) const { return name.size(); }
+    bool empty(void) const { return name.empty(); }
+
+    std::vector<std::string> name;              ///< Name of the radio
+    std::vector<std::string> type;              ///< Radio type
+    std::vector<std::string> net_id_active;     ///< Unique ID of the active net
+    std::vector<std::string> net_name_active;   ///< Name of the active net
+    std::vector<std::string> effects;           ///< Unique ID of the radio effects
+    std::vector<float>       volume;            ///< Volume, 0 to 100
+    std::vector<float>       volume_left;       ///< Left stereo volume
+    std::vector<float>       volume_right;      ///< Right stereo volume
+    std::vector<int>         balance;           ///< ::Balance_t
+    std::vector<int>         ptt;               ///< PTT index keying the radio
+    std::vector<unsigned char> locks;           ///< ::RadioLock_t bits
+    std::vector<std::vector<NetInfo> > nets;    ///< Nets assigned to the radio
+    std::vector<NetIndex>    net_index;         ///< Net key to index in nets
+    std::vector<int>         net_active;        ///< Index of the active net in nets, -1 if unassigned
+    std::vector<unsigned long long> rx_frequency;   ///< Receive frequency of the active net in Hz
+    std::vector<unsigned long long> tx_frequency;   ///< Transmit frequency of the active net in Hz
+    FreqIndex                frequencies;       ///< Every net and active frequency, sorted
+};
+
+/// Net assigned to a jammer
+struct JammerNetInfo
+{
+    std::string         id;                 ///< Unique ID of the net
+    NetKey              key;                ///< Interned ID
+    std::string         name;               ///< Name of the net
+};
+
+/// Jammer state
+struct JammerInfo
+{
+    std::string         net_id_active;      ///< Unique ID of the active net
+    int                 transmitting;       ///< 1 if transmitting
+    int                 state;              ///< ::JammerRecordReplayState_t
+    int                 progress;           ///< Record/replay progress in percent
+    int                 duration_ms;        ///< Record/replay duration
+    std::vector<JammerNetInfo> nets;        ///< Nets assigned to the jammer
+    NetIndex            net_index;          ///< Net key to index in nets
+    int                 net_active;         ///< Index of the active net in nets, -1 if unassigned
+};
+
+/// Named item with a unique ID (roles, entity states, radio effects, playsounds)
+struct NamedInfo
+{
+    std::string         id;                 ///< Unique ID
+    std::string         name;               ///< Display name
+};
+
+/// Endpoint on a call
+struct EndpointInfo
+{
+    std::string         id;                 ///< Unique ID of the endpoint
+    CallKey             key;                ///< Decoded ID
+    int                 state;              ///< Call progress state
+};
+
+/// Call and its endpoints
+struct CallInfo
+{
+    std::string         id;                 ///< Unique ID of the call
+    CallKey             key;                ///< Decoded ID
+    std::vector<EndpointInfo> endpoints;
+};
+
+/// @brief Every call with an index over call and endpoint IDs
+/// @details Rebuilt from scratch, table and index, whenever
+/// Call_Endpoint_Version moves, in one walk of the libvrcc call and endpoint
+/// iterators. Looking up a call or an endpoint state afterwards never walks
+/// them again.
+struct CallTable
+{
+    size_t size(void) const { return calls.size(); }
+    bool empty(void) const { return calls.empty(); }
+    const CallInfo& operator[](size_t i) const { return calls[i]; }
+
+    /// @brief Finds a call by ID
+    /// @returns the call, or NULL if there is no such call
+    const CallInfo* find(const char* call_id) const;
+
+    /// @brief Gets the state of an endpoint on a call, as Call_Endpoint_State
+    /// @returns ::CallProgress_t, or -1 if there is no such endpoint
+    int endpoint_state(const char* call_id, const char* endpoint_id) const;
+
+    std::vector<CallInfo> calls;            ///< In Call_IDFirst/Call_IDNext order
+    CallIndex           index;
+};
+
+/// Pending call invitation
+struct InvitationInfo
+{
+    std::string         call_id;            ///< Unique ID of the call
+    std::string         endpoint_id;        ///< Unique ID of the inviter
+};
+
+/// Cloud and its server count
+struct CloudInfo
+{
+    std::string         id;                 ///< Unique ID of the cloud
+    int                 server_count;       ///< Servers in the cloud
+};
+
+/// Audio device
+struct AudioDeviceInfo
+{
+    int                 type;               ///< ::AudioDeviceType_t
+    std::string         id;                 ///< Unique ID of the device
+    std::string         name;               ///< Name of the device
+    int                 active;             ///< 1 if the device is in use
+};
+
+/// @brief Latest state of every domain
+/// @details Each cache is immutable once built. When a domain's counter
+/// moves the engine builds a new cache and swaps the pointer, so copies of
+/// this struct (e.g. in a Snapshot) share unchanged domains for free.
+struct DomainCaches
+{
+    std::shared_ptr<const ConnectionInfo> connection;
+    std::shared_ptr<const RadioTable> radios;
+    std::shared_ptr<const std::vector<unsigned char> > radio_flags;  ///< ::RadioFlag_t bits per radio
+    std::shared_ptr<const std::vector<JammerInfo> > jammers;
+    std::shared_ptr<const std::vector<NamedInfo> > roles;
+    std::shared_ptr<const std::vector<NamedInfo> > entity_states;
+    std::shared_ptr<const OperatorTable> operators;
+    std::shared_ptr<const CallTable> calls;
+    std::shared_ptr<const std::vector<InvitationInfo> > invitations;
+    std::shared_ptr<const std::vector<CloudInfo> > clouds;
+    std::shared_ptr<const std::vector<NamedInfo> > radio_effects;
+    std::shared_ptr<const std::vector<AudioDeviceInfo> > audio_devices;
+    std::shared_ptr<const std::vector<NamedInfo> > playsounds;
+};
+
+/// @brief Re-enumerates the domains whose version counter moved
+/// @details Call after every VRCC_Update() on the libvrcc thread. Every
+/// domain is refreshed on the first call and after the connection state
+/// changes, since counters may restart with a new server.
+/// @param update_changed return value of VRCC_Update()
+/// @returns bitmask of (1 << ::Domain_t) for the domains that were refreshed,
+/// plus REFRESH_RADIO_FLAGS if only the radio flags changed
+unsigned int refresh_update(int update_changed);
+
+/// Set in the result of refresh_update() when the polled radio flags changed
+#define REFRESH_RADIO_FLAGS (1u << DOMAIN_COUNT)
+
+/// @brief Forces the connection domain to be refreshed on the next update
+/// @details Connection state has no version counter; call this after making
+/// library calls that may change it.
+void refresh_invalidate_connection(void);
+
+/// @brief Gets the per-domain caches
+/// @note Must be called from the libvrcc thread; other threads use SnapshotReader.
+const DomainCaches& refresh_caches(void);
+
+/// @brief Gets the name of a domain for display
+const char* refresh_domain_name(int domain);
+
+/// @brief Gets how many times a domain has been re-enumerated
+unsigned long refresh_count(int domain);
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ *  Voisus SDK Example bulk radio retune
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "retune.h"
+#include "vrcc_timed.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// on/off, true/false or 1/0, -1 if none of them
+static int parse_enable(const char* value)
+{
+    if (!strcmp(value, "on") || !strcmp(value, "true") || !strcmp(value, "1"))
+        return 1;
+    if (!strcmp(value, "off") || !strcmp(value, "false") || !strcmp(value, "0"))
+        return 0;
+    return -1;
+}
+
+// Parses the fields of one plan line into entry
+static int parse_entry(char* text, const Snapshot& snap, TuneEntry& entry,
+                       char* error, size_t errsz)
+{
+    const RadioTable& radios = *snap.radios;
+    const char* radio = strtok(text, " \t");
+    const char* net = strtok(NULL, " \t");
+    if (!net)
+    {   snprintf(error, errsz, "expected <radio> <net>");
+        return 0;
+    }
+    entry.radio = atoi(radio);
+    if ((entry.radio < 0) || (entry.radio >= (int)radios.size()) || (strspn(radio, "0123456789") != strlen(radio)))
+    {   snprintf(error, errsz, "no radio %s", radio);
+        return 0;
+    }
+    entry.net = -1;
+    if (strcmp(net, "-"))
+    {   size_t len = strlen(net);
+        if ((len < 10) && (strspn(net, "0123456789") == len))
+            entry.net = atoi(net);
+        else
+            entry.net = radios.net_index[entry.radio].find(net);
+        if ((entry.net < 0) || (entry.net >= (int)radios.nets[entry.radio].size()))
+        {   snprintf(error, errsz, "radio %d has no net %s", entry.radio, net);
+            return 0;
+        }
+    }
+    entry.rx = entry.tx = -1;
+    entry.volume = -1;
+    for (char* opt = strtok(NULL, " \t"); opt; opt = strtok(NULL, " \t"))
+    {   char* value = strchr(opt, '=');
+        if (value)
+            *value++ = '\0';
+        if (value && !strcmp(opt, "rx") && (-1 != (entry.rx = parse_enable(value))))
+            continue;
+        if (value && !strcmp(opt, "tx") && (-1 != (entry.tx = parse_enable(value))))
+            continue;
+        if (value && !strcmp(opt, "volume"))
+        {   entry.volume = (float)atof(value);
+            if ((entry.volume >= 0) && (entry.volume <= 100))
+                continue;
+        }
+        snprintf(error, errsz, "bad option %s%s%s", opt, value ? "=" : "", value ? value : "");
+        return 0;
+    }
+    return 1;
+}
+
+int tune_load(const char* path, const Snapshot& snap, std::vector<TuneEntry>& plan,
+              char* error, size_t errsz)
+{
+    FILE* file = fopen(path, "r");
+    if (!file)
+    {   snprintf(error, errsz, "Cannot open %s.", path);
+        return 0;
+    }
+    char text[512];
+    char reason[128];
+    int ok = 1;
+    for (int line = 1; ok && fgets(text, sizeof(text), file); line++)
+    {   text[strcspn(text, "#\r\n")] = '\0';
+        if (!text[strspn(text, " \t")])
+            continue;
+        TuneEntry entry;
+        entry.line = line;
+        entry.latency_ms = -1;
+        ok = parse_entry(text, snap, entry, reason, sizeof(reason));
+        if (ok)
+            plan.push_back(entry);
+        else
+            snprintf(error, errsz, "%s:%d: %s.", path, line, reason);
+    }
+    fclose(file);
+    return ok;
+}
+
+void tune_apply(const std::vector<TuneEntry>& plan)
+{
+    for (size_t i = 0; i < plan.size(); i++)
+    {   const TuneEntry& entry = plan[i];
+        if (entry.net >= 0)
+            Radio_SetNet(entry.radio, entry.net);
+        if (entry.rx >= 0)
+            Radio_SetReceiveEnabled(entry.radio, entry.rx);
+        if (entry.tx >= 0)
+            Radio_SetTransmitEnabled(entry.radio, entry.tx);
+        if (entry.volume >= 0)
+            Radio_SetVolume(entry.radio, entry.volume);
+    }
+}
+
+int tune_confirmed(const Snapshot& snap, const TuneEntry& entry)
+{
+    const RadioTable& radios = *snap.radios;
+    if (entry.radio >= (int)radios.size())
+        return 0;
+    int flags = (*snap.radio_flags)[entry.radio];
+    return ((entry.net < 0) || (radios.net_active[entry.radio] == entry.net)) &&
+           ((entry.rx < 0) || (!(flags & RADIO_RX_ENABLED) == !entry.rx)) &&
+           ((entry.tx < 0) || (!(flags & RADIO_TX_ENABLED) == !entry.tx)) &&
+           ((entry.volume < 0) || (fabs(radios.volume[entry.radio] - entry.volume) < 0.5));
+}
@@ -0,0 +1,66 @@
+/*
+ *  Voisus SDK Example bulk radio retune
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef RETUNE_H
+#define RETUNE_H
+
+#include "snapshot.h"
+#include <stddef.h>
+#include <vector>
+
+/// @brief Target state of one radio in a retune plan
+/// @details Fields set to -1 are left unchanged.
+struct TuneEntry
+{
+    int                 radio;              ///< Radio index
+    int                 net;                ///< Net index
+    int                 rx;                 ///< Receive enable
+    int                 tx;                 ///< Transmit enable
+    float               volume;             ///< Volume, 0 to 100
+    int                 line;               ///< Line in the plan file
+    double              latency_ms;         ///< Time to confirmation, -1 until confirmed
+};
+
+/// @brief Loads a retune plan
+/// @details One radio per line, "#" starts a comment:
+///
+///     <radio> <net>|- [rx=on|off] [tx=on|off] [volume=0-100]
+///
+/// The net is an index or a net ID, resolved against the snapshot's radio
+/// table.
+/// @param error Receives a message when the plan is rejected
+/// @returns 1 on success, 0 on error
+int tune_load(const char* path, const Snapshot& snap, std::vector<TuneEntry>& plan,
+              char* error, size_t errsz);
+
+/// @brief Applies every entry of a plan in one pass
+/// @note Must be called from the thread that owns libvrcc (see vrcc_call).
+void tune_apply(const std::vector<TuneEntry>& plan);
+
+/// @brief Checks whether a snapshot shows a radio in its planned state
+/// @details The net is confirmed by the active net ID, as indexed when
+/// Radio_Version moved.
+/// @returns 1 if confirmed
+int tune_confirmed(const Snapshot& snap, const TuneEntry& entry);
+
+#endif
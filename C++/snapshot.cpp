@@ -0,0 +1,61 @@
+/*
+ *  Voisus SDK Example state snapshots
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "snapshot.h"
+#include <atomic>
+
+static Snapshot Buffers[2];
+static std::atomic<int> Readers[2] = {{0}, {0}};
+static std::atomic<int> Front(0);
+
+SnapshotReader::SnapshotReader()
+{
+    // Pin the front buffer, retrying if the writer flipped it in between
+    while (1)
+    {   slot = Front.load();
+        Readers[slot].fetch_add(1);
+        if (slot == Front.load())
+            break;
+        Readers[slot].fetch_sub(1);
+    }
+    snap = &Buffers[slot];
+}
+
+SnapshotReader::~SnapshotReader()
+{
+    Readers[slot].fetch_sub(1);
+}
+
+int snapshot_publish(void)
+{
+    int front = Front.load();
+    int back = 1 - front;
+    if (Readers[back].load())
+        return 0;
+
+    Snapshot& snap = Buffers[back];
+    static_cast<DomainCaches&>(snap) = refresh_caches();
+    snap.sequence = Buffers[front].sequence + 1;
+    Front.store(back);
+    return 1;
+}
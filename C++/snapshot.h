@@ -0,0 +1,61 @@
+/*
+ *  Voisus SDK Example state snapshots
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "refresh.h"
+
+/// Immutable copy of the client state published by the libvrcc thread
+struct Snapshot : DomainCaches
+{
+    unsigned long       sequence;           ///< Incremented on every publish
+};
+
+/// @brief Pins the latest snapshot for reading
+/// @details Snapshots are double-buffered. Readers never lock and never touch
+/// libvrcc; a pinned buffer is only skipped over by the writer, so holding a
+/// reader never stalls the update thread. Keep readers short-lived so the
+/// writer is not held to a single buffer.
+class SnapshotReader
+{
+public:
+    SnapshotReader();
+    ~SnapshotReader();
+    const Snapshot& operator*() const { return *snap; }
+    const Snapshot* operator->() const { return snap; }
+
+private:
+    SnapshotReader(const SnapshotReader&);
+    SnapshotReader& operator=(const SnapshotReader&);
+    int slot;
+    const Snapshot* snap;
+};
+
+/// @brief Copies the refresh engine caches into the back buffer and publishes it
+/// @details Only pointers to the per-domain caches are copied.
+/// @note Must be called from the thread that owns libvrcc.
+/// @returns 1 if published, 0 if deferred because a reader still pins the back buffer
+int snapshot_publish(void);
+
+#endif
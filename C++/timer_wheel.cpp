@@ -0,0 +1,133 @@
+/*
+ *  Voisus SDK Example hierarchical timer wheel
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "timer_wheel.h"
+#include <algorithm>
+
+static int shift(int level)
+{
+    return 8 + 6 * level;                   // ROOT_BITS + LEVEL_BITS * level
+}
+
+TimerWheel::TimerWheel()
+    : current(0),
+      seq(0),
+      count(0)
+{
+}
+
+void TimerWheel::reset(uint64_t now_ms)
+{
+    for (int s = 0; s < ROOT_SLOTS; s++)
+        root[s].clear();
+    for (int l = 0; l < LEVELS - 1; l++)
+    {   for (int s = 0; s < LEVEL_SLOTS; s++)
+            levels[l][s].clear();
+    }
+    current = now_ms;
+    count = 0;
+}
+
+void TimerWheel::place(const Timer& timer, uint64_t earliest)
+{
+    uint64_t when = std::max(timer.when, earliest);
+    uint64_t delta = when - current;
+    if (delta < ROOT_SLOTS)
+    {   root[when & (ROOT_SLOTS - 1)].push_back(timer);
+        return;
+    }
+    for (int l = 0; l < LEVELS - 1; l++)
+    {   if ((delta < (1ull << shift(l + 1))) || (l == LEVELS - 2))
+        {   // Beyond the top level, wait in its furthest slot and re-place
+            if (delta >= (1ull << shift(l + 1)))
+                when = current + (1ull << shift(l + 1)) - 1;
+            levels[l][(when >> shift(l)) & (LEVEL_SLOTS - 1)].push_back(timer);
+            return;
+        }
+    }
+}
+
+void TimerWheel::schedule(uint64_t when_ms, const std::function<void()>& func)
+{
+    Timer timer = {when_ms, seq++, func};
+    place(timer, current + 1);
+    count++;
+}
+
+void TimerWheel::cascade(int level)
+{
+    std::vector<Timer> timers;
+    timers.swap(levels[level][(current >> shift(level)) & (LEVEL_SLOTS - 1)]);
+    // Cascades run before the current slot is drained, so timers due now
+    // still fire this millisecond
+    for (size_t i = 0; i < timers.size(); i++)
+        place(timers[i], current);
+}
+
+void TimerWheel::advance(uint64_t now_ms)
+{
+    if (!count)
+    {   current = std::max(current, now_ms);
+        return;
+    }
+    while (current < now_ms)
+    {   current++;
+        // Each level turns over when the one below wraps
+        if (0 == (current & (ROOT_SLOTS - 1)))
+        {   int top = 0;
+            while ((top < LEVELS - 2) && (0 == ((current >> shift(top)) & (LEVEL_SLOTS - 1))))
+                top++;
+            for (int l = top; l >= 0; l--)
+                cascade(l);
+        }
+        std::vector<Timer>& slot = root[current & (ROOT_SLOTS - 1)];
+        if (slot.empty())
+            continue;
+        std::vector<Timer> due;
+        due.swap(slot);
+        std::sort(due.begin(), due.end(), [](const Timer& a, const Timer& b) { return a.seq < b.seq; });
+        count -= due.size();
+        for (size_t i = 0; i < due.size(); i++)
+            due[i].func();
+        if (!count)
+        {   current = std::max(current, now_ms);
+            return;
+        }
+    }
+}
+
+int64_t TimerWheel::next_ms(uint64_t now_ms) const
+{
+    if (!count)
+        return -1;
+    if (now_ms <= current)
+        now_ms = current;
+    // Timers in the root fire in their slot; anything else waits for the
+    // next cascade when the root wraps
+    uint64_t wrap = (current | (ROOT_SLOTS - 1)) + 1;
+    for (uint64_t t = current + 1; t < wrap; t++)
+    {   if (!root[t & (ROOT_SLOTS - 1)].empty())
+            return (t > now_ms) ? (int64_t)(t - now_ms) : 0;
+    }
+    return (wrap > now_ms) ? (int64_t)(wrap - now_ms) : 0;
+}
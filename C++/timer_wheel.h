@@ -0,0 +1,82 @@
+/*
+ *  Voisus SDK Example hierarchical timer wheel
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/// @brief Hierarchical timer wheel with 1 ms resolution
+/// @details Level 0 has 256 one-millisecond slots; each of the three levels
+/// above has 64 slots, each covering a whole turn of the level below, so
+/// timers up to about 18 hours out are placed in O(1) and cascade down as
+/// their time nears. Later timers wait in the top level and are re-placed.
+/// Timers due in the same millisecond fire in the order they were added.
+/// Not thread-safe.
+class TimerWheel
+{
+public:
+    TimerWheel();
+
+    /// @brief Sets the current time, dropping every timer
+    void reset(uint64_t now_ms);
+
+    /// @brief Adds a timer
+    /// @param when_ms Absolute time; times already passed fire on the next advance
+    void schedule(uint64_t when_ms, const std::function<void()>& func);
+
+    /// @brief Fires every timer due up to and including now_ms
+    void advance(uint64_t now_ms);
+
+    /// @brief Gets how long until the wheel next needs advancing
+    /// @returns ms until the next timer or cascade, -1 if no timers are pending
+    int64_t next_ms(uint64_t now_ms) const;
+
+    /// @brief Gets the number of pending timers
+    size_t pending(void) const { return count; }
+
+private:
+    enum { LEVELS = 4, ROOT_BITS = 8, LEVEL_BITS = 6,
+           ROOT_SLOTS = 1 << ROOT_BITS, LEVEL_SLOTS = 1 << LEVEL_BITS };
+
+    struct Timer
+    {
+        uint64_t when;
+        uint64_t seq;
+        std::function<void()> func;
+    };
+
+    void place(const Timer& timer, uint64_t earliest);
+    void cascade(int level);
+
+    std::vector<Timer> root[ROOT_SLOTS];
+    std::vector<Timer> levels[LEVELS - 1][LEVEL_SLOTS];
+    uint64_t current;                       // Last millisecond processed
+    uint64_t seq;
+    size_t count;
+};
+
+#endif
@@ -0,0 +1,309 @@
+/*
+ *  Voisus SDK query benchmarks
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/// @file
+/// @brief Measures the libvrcc query patterns used by voisus-sdk-example
+/// @details Runs against the simulated library in fake_vrcc.cpp, sweeping the
+/// number of radios and nets per radio, and prints one result per case and
+/// configuration as CSV (default) or JSON lines.
+///
+///     voisus-bench [--radios 8,64] [--nets 4,16,64,256] [--calls 16]
+///                  [--operators 256] [--time-ms 200] [--format csv|json]
+
+#include "fake_vrcc.h"
+#include "api_stats.h"
+#include "operator_directory.h"
+#include "refresh.h"
+#include <chrono>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char* name;
+    void (*func)(void);
+} BENCH_T;
+
+// Results are accumulated here so the queries are not optimized away
+static volatile size_t Sink;
+
+static std::vector<int> Radios;
+static std::vector<int> Nets;
+static int Calls = 16;
+static int Operators = 256;
+static int Time_ms = 200;
+static int Json = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Cases
+///////////////////////////////////////////////////////////////////////////////
+
+/// get_radios: the queries print_radio makes for every radio
+static void bench_get_radios(void)
+{
+    int count = Radio_ListCount();
+    for (int i = 0; i < count; i++)
+    {   Sink += strlen(Radio_Name(i));
+        Sink += strlen(Radio_NetNameActive(i));
+        Sink += Radio_IsTransmitEnabled(i) + Radio_IsReceiveEnabled(i);
+        Sink += Radio_IsReceiving(i) + Radio_IsTransmitting(i);
+    }
+}
+
+/// table_radios: the same fields read from the cached radio table
+static void bench_table_radios(void)
+{
+    const DomainCaches& caches = refresh_caches();
+    const RadioTable& radios = *caches.radios;
+    const std::vector<unsigned char>& flags = *caches.radio_flags;
+    for (int i = 0; i < (int)radios.size(); i++)
+    {   Sink += radios.name[i].size();
+        Sink += radios.net_name_active[i].size();
+        Sink += flags[i];
+    }
+}
+
+/// get_radio_nets: every net of a radio compared against its active net
+static void bench_get_radio_nets(void)
+{
+    int count = Radio_NetListCount(0);
+    for (int n = 0; n < count; n++)
+    {   Sink += strlen(Radio_NetName(0, n));
+        Sink += !strcmp(Radio_NetID(0, n), Radio_NetIDActive(0));
+    }
+}
+
+/// print_jammer: scan for the active net, which is set to the last one
+static void bench_print_jammer(void)
+{
+    int count = Jammer_NetListCount(0);
+    for (int n = 0; n < count; n++)
+    {   if (0 == strcmp(Jammer_NetID(0, n), Jammer_NetIDActive(0)))
+        {   Sink += strlen(Jammer_NetName(0, n));
+            break;
+        }
+    }
+    Sink += Jammer_IsTransmitting(0) + Jammer_RecordReplayState(0);
+    Sink += Jammer_RecordReplayProgress(0) + Jammer_RecordReplayDurationMs(0);
+}
+
+/// table_jammer: the active net of the cached jammer through its net index
+static void bench_table_jammer(void)
+{
+    const JammerInfo& jammer = (*refresh_caches().jammers)[0];
+    if (jammer.net_active >= 0)
+        Sink += jammer.nets[jammer.net_active].name.size();
+    Sink += jammer.net_index.find(jammer.net_id_active.c_str());
+}
+
+/// Call_IDFirst/Call_IDNext iteration with each call's endpoints
+static void bench_call_iterate(void)
+{
+    Call_GetLock();
+    for (const char* id = Call_IDFirst(); strlen(id); id = Call_IDNext())
+    {   for (const char* ep = Call_Endpoint_IDFirst(id); strlen(ep); ep = Call_Endpoint_IDNext(id))
+            Sink += Call_Endpoint_State(id, ep);
+    }
+    Call_ReleaseLock();
+}
+
+/// table_calls: the state of the last endpoint of the last call through the call index
+static void bench_table_calls(void)
+{
+    const CallTable& calls = *refresh_caches().calls;
+    if (calls.empty() || calls[calls.size() - 1].endpoints.empty())
+        return;
+    const CallInfo& call = calls[calls.size() - 1];
+    Sink += calls.endpoint_state(call.id.c_str(), call.endpoints.back().id.c_str());
+}
+
+/// operator_fields: connected operators not on a call in a role, field by field
+static void bench_operator_fields(void)
+{
+    Operator_GetLock();
+    for (const char* id = Operator_IDFirst(); strlen(id); id = Operator_IDNext())
+    {   std::string uuid = id;
+        Sink += !strcmp(Operator_GetField(uuid.c_str(), "connected"), "true") &&
+                strcmp(Operator_GetField(uuid.c_str(), "callactive"), "true") &&
+                !strcmp(Operator_GetField(uuid.c_str(), "role"), "Role 1");
+    }
+    Operator_ReleaseLock();
+}
+
+/// table_operators: the same query as a filter over the operator table
+static void bench_table_operators(void)
+{
+    static OperatorFilter filter;
+    static int parsed = filter.parse("connected && !callactive && role=Role 1", NULL, 0);
+    static std::vector<uint64_t> mask;
+    if (parsed)
+        Sink += filter.match(*refresh_caches().operators, mask);
+}
+
+/// One owner thread tick when the radio version moves every update
+static void bench_refresh_radios(void)
+{
+    Sink += refresh_update(VRCC_Update());
+}
+
+static const BENCH_T Benches[] = {{"get_radios", bench_get_radios},
+                                  {"table_radios", bench_table_radios},
+                                  {"get_radio_nets", bench_get_radio_nets},
+                                  {"print_jammer", bench_print_jammer},
+                                  {"table_jammer", bench_table_jammer},
+                                  {"call_iterate", bench_call_iterate},
+                                  {"table_calls", bench_table_calls},
+                                  {"operator_fields", bench_operator_fields},
+                                  {"table_operators", bench_table_operators},
+                                  {"refresh_radios", bench_refresh_radios}};
+
+///////////////////////////////////////////////////////////////////////////////
+// Harness
+///////////////////////////////////////////////////////////////////////////////
+
+static void setup(int radios, int nets)
+{
+    FakeVrccConfig_t config;
+    FakeVrcc_DefaultConfig(&config);
+    config.radios = radios;
+    config.nets_per_radio = nets;
+    config.plan_nets = nets * 4;
+    config.jammers = 1;
+    config.nets_per_jammer = nets;
+    config.calls = Calls;
+    config.operators = Operators;
+    config.connected = 1;
+    config.tick_ms = 0;
+    config.apply_ticks = 1;
+    config.activity_permille = 0;
+    FakeVrcc_Configure(&config);
+    VRCC_Start(0, NULL);
+    Jammer_SetNetID(0, Jammer_NetID(0, nets - 1));
+    VRCC_Update();
+    refresh_update(VRCC_Update());
+    FakeVrcc_Script("every 1 bump radio");
+}
+
+static void run(const BENCH_T& bench, int radios, int nets)
+{
+    static LatencyHistogram latency;
+    typedef std::chrono::steady_clock clock;
+    latency.reset();
+
+    // Warm up caches and the allocator before measuring
+    for (int i = 0; i < 10; i++)
+        bench.func();
+
+    clock::time_point start = clock::now();
+    clock::time_point end = start + std::chrono::milliseconds(Time_ms);
+    clock::time_point now = start;
+    while (now < end)
+    {   clock::time_point before = now;
+        bench.func();
+        now = clock::now();
+        latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(now - before).count());
+    }
+    double seconds = std::chrono::duration<double>(now - start).count();
+    unsigned long long count = latency.count();
+    double mean_ns = count ? (double)latency.total() / count : 0.0;
+    double ops = seconds > 0.0 ? count / seconds : 0.0;
+
+    if (Json)
+        printf("{\"case\": \"%s\", \"radios\": %d, \"nets_per_radio\": %d, \"plan_nets\": %d, "
+               "\"iterations\": %llu, \"mean_ns\": %.1f, \"p50_ns\": %llu, \"p99_ns\": %llu, "
+               "\"max_ns\": %llu, \"ops_per_sec\": %.1f}\n",
+               bench.name, radios, nets, nets * 4, count, mean_ns,
+               (unsigned long long)latency.percentile(50.0),
+               (unsigned long long)latency.percentile(99.0),
+               (unsigned long long)latency.max(), ops);
+    else
+        printf("%s,%d,%d,%d,%llu,%.1f,%llu,%llu,%llu,%.1f\n",
+               bench.name, radios, nets, nets * 4, count, mean_ns,
+               (unsigned long long)latency.percentile(50.0),
+               (unsigned long long)latency.percentile(99.0),
+               (unsigned long long)latency.max(), ops);
+    fflush(stdout);
+}
+
+static std::vector<int> parse_list(const char* str)
+{
+    std::vector<int> list;
+    for (const char* p = str; *p; )
+    {   int value = atoi(p);
+        if (value > 0)
+            list.push_back(value);
+        p = strchr(p, ',');
+        if (!p)
+            break;
+        p++;
+    }
+    return list;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: voisus-bench [--radios 8,64] [--nets 4,16,64,256] [--calls 16]\n"
+                    "                    [--operators 256] [--time-ms 200] [--format csv|json]\n");
+    exit(2);
+}
+
+int main(int argc, char* argv[])
+{
+    Radios = parse_list("8,64");
+    Nets = parse_list("4,16,64,256");
+    for (int i = 1; i < argc; i++)
+    {   if (i + 1 >= argc)
+            usage();
+        if (0 == strcmp(argv[i], "--radios"))
+            Radios = parse_list(argv[++i]);
+        else if (0 == strcmp(argv[i], "--nets"))
+            Nets = parse_list(argv[++i]);
+        else if (0 == strcmp(argv[i], "--calls"))
+            Calls = atoi(argv[++i]);
+        else if (0 == strcmp(argv[i], "--operators"))
+            Operators = atoi(argv[++i]);
+        else if (0 == strcmp(argv[i], "--time-ms"))
+            Time_ms = atoi(argv[++i]);
+        else if (0 == strcmp(argv[i], "--format"))
+            Json = (0 == strcmp(argv[++i], "json"));
+        else
+            usage();
+    }
+    if (Radios.empty() || Nets.empty())
+        usage();
+
+    if (!Json)
+        printf("case,radios,nets_per_radio,plan_nets,iterations,mean_ns,p50_ns,p99_ns,max_ns,ops_per_sec\n");
+    for (size_t r = 0; r < Radios.size(); r++)
+    {   for (size_t n = 0; n < Nets.size(); n++)
+        {   setup(Radios[r], Nets[n]);
+            for (size_t b = 0; b < sizeof(Benches) / sizeof(Benches[0]); b++)
+                run(Benches[b], Radios[r], Nets[n]);
+            VRCC_Shutdown();
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,452 @@
+/*
+ *  Voisus SDK client fleet launcher
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/// @file
+/// @brief Forks a fleet of Voisus clients to load test a server
+/// @details libvrcc is a per-process singleton, so every client is a forked
+/// agent process with its own library instance. The launcher and agents
+/// share an anonymous MAP_SHARED region holding one FleetAgent per client:
+/// the launcher writes the client's configuration and commands into it, and
+/// the agent publishes its connection progress, timings and errors back.
+///
+///     voisus-fleet -s <server ip> [-n 8] [-r role] [-p fleet] [-i 100]
+///                  [-d 30] [-t 30] [-S 1]
+
+#include "vrcc_timed.h"
+#include "snapshot.h"
+#include "vrcc_thread.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Shared command and status plane
+///////////////////////////////////////////////////////////////////////////////
+
+/// Commands sent from the launcher to an agent
+enum FleetCommand_t
+{
+    FLEET_CMD_NONE,
+    FLEET_CMD_CONNECT,              ///< Connect to the server and set the role
+    FLEET_CMD_QUIT                  ///< Shut down libvrcc and exit
+};
+
+/// Progress of an agent
+enum FleetPhase_t
+{
+    FLEET_STARTING,                 ///< Forked, starting libvrcc
+    FLEET_READY,                    ///< Waiting for FLEET_CMD_CONNECT
+    FLEET_CONNECTING,               ///< Voisus_ConnectServer called
+    FLEET_ROLE_SET,                 ///< Role_SetRole called
+    FLEET_CONNECTED,                ///< Connected to the role
+    FLEET_FAILED,                   ///< VRCC_Start failed, or -t passed before connecting
+    FLEET_EXITED                    ///< Process has exited
+};
+
+static const char* Phase_names[] = {"starting", "ready", "connecting", "role_set",
+                                    "connected", "failed", "exited"};
+
+/// One client's slot in the shared region
+struct FleetAgent
+{
+    // Configuration, written by the launcher before the fork
+    char                    client_name[32];
+    char                    server_ip[64];
+    int                     role;           ///< Role index, -1 to use agent index modulo role count
+    DISParams_t             dis;
+
+    // Command plane, written by the launcher
+    std::atomic<int>        command;        ///< ::FleetCommand_t
+    std::atomic<unsigned>   command_seq;    ///< Incremented after command is written
+
+    // Status plane, written by the agent
+    std::atomic<unsigned>   ack_seq;        ///< Last command_seq handled
+    std::atomic<int>        pid;
+    std::atomic<int>        phase;          ///< ::FleetPhase_t
+    std::atomic<int>        connect_state;  ///< ::ConnectState_t
+    std::atomic<int>        error;          ///< ::Error_t
+    std::atomic<int>        radios;         ///< Radios in the connected role
+    std::atomic<long long>  connect_us;     ///< Voisus_ConnectServer to connected, -1 until then
+    std::atomic<long long>  role_us;        ///< Role_SetRole to ROLE_CONNECTED, -1 until then
+};
+
+static FleetAgent* Agents;
+static int Agent_count = 8;
+static volatile sig_atomic_t Stop;
+
+typedef std::chrono::steady_clock Clock;
+
+static long long elapsed_us(Clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+}
+
+static void sleep_ms(int ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Moves an agent on only from the phase expected, so a launcher timeout
+// that marked it failed is never overwritten
+static int set_phase(FleetAgent& agent, int from, int to)
+{
+    return agent.phase.compare_exchange_strong(from, to);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Agent
+///////////////////////////////////////////////////////////////////////////////
+
+static int run_agent(int index, FleetAgent& agent)
+{
+    char name[] = "voisus-fleet";
+    char* argv[] = {name, NULL};
+    agent.pid = getpid();
+    if (!vrcc_thread_start(1, argv))
+    {   agent.phase = FLEET_FAILED;
+        return 1;
+    }
+    vrcc_call([&] {
+        Network_SetClientName(agent.client_name);
+        DIS_SetParams(&agent.dis);
+    });
+    set_phase(agent, FLEET_STARTING, FLEET_READY);
+
+    unsigned int seen = agent.command_seq.load(std::memory_order_acquire);
+    Clock::time_point connect_start = Clock::now();
+    Clock::time_point role_start = Clock::now();
+    Clock::time_point error_poll = Clock::now();
+    int quit = 0;
+    while (!quit)
+    {   unsigned int seq = agent.command_seq.load(std::memory_order_acquire);
+        if (seq != seen)
+        {   seen = seq;
+            switch (agent.command.load())
+            {   case FLEET_CMD_CONNECT:
+                    agent.connect_us = -1;
+                    agent.role_us = -1;
+                    if (!set_phase(agent, FLEET_READY, FLEET_CONNECTING))
+                        break;
+                    connect_start = Clock::now();
+                    vrcc_call([&] { Voisus_ConnectServer(agent.server_ip); });
+                    break;
+                case FLEET_CMD_QUIT:
+                    quit = 1;
+                    break;
+            }
+            agent.ack_seq.store(seen, std::memory_order_release);
+        }
+
+        std::string role_id;
+        {   SnapshotReader snap;
+            const ConnectionInfo& conn = *snap->connection;
+            agent.connect_state = conn.connect_state;
+            agent.radios = (int)snap->radios->size();
+            if ((FLEET_CONNECTING == agent.phase) && (agent.connect_us < 0) &&
+                (STATUS_CONNECTED == conn.connection_status))
+                agent.connect_us = elapsed_us(connect_start);
+            if ((FLEET_CONNECTING == agent.phase) && (agent.connect_us >= 0) &&
+                !snap->roles->empty())
+            {   int role = (agent.role >= 0) ? agent.role : index;
+                role_id = (*snap->roles)[role % snap->roles->size()].id;
+            }
+            else if ((FLEET_ROLE_SET == agent.phase) && (ROLE_CONNECTED == conn.connect_state))
+            {   if (set_phase(agent, FLEET_ROLE_SET, FLEET_CONNECTED))
+                    agent.role_us = elapsed_us(role_start);
+            }
+        }
+        if (!role_id.empty() && set_phase(agent, FLEET_CONNECTING, FLEET_ROLE_SET))
+        {   role_start = Clock::now();
+            vrcc_call([&] { Role_SetRole(role_id.c_str()); });
+        }
+
+        // Voisus_Error is not part of the snapshot, so poll it slowly
+        if (elapsed_us(error_poll) > 500000)
+        {   int error = ERROR_OFF;
+            vrcc_call([&] { error = Voisus_Error(); });
+            agent.error = error;
+            error_poll = Clock::now();
+        }
+        sleep_ms(5);
+    }
+    vrcc_thread_stop();
+    int phase = agent.phase;
+    if (FLEET_FAILED != phase)
+        set_phase(agent, phase, FLEET_EXITED);
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Launcher
+///////////////////////////////////////////////////////////////////////////////
+
+// Sends a command once the agent has acknowledged the previous one
+static void send_command(FleetAgent& agent, int command)
+{
+    for (int i = 0; i < 200; i++)
+    {   if (agent.ack_seq.load(std::memory_order_acquire) ==
+            agent.command_seq.load(std::memory_order_relaxed))
+            break;
+        sleep_ms(5);
+    }
+    agent.command.store(command, std::memory_order_relaxed);
+    agent.command_seq.fetch_add(1, std::memory_order_release);
+}
+
+static void reap(std::vector<pid_t>& pids, int options)
+{
+    for (int i = 0; i < Agent_count; i++)
+    {   int status;
+        if (pids[i] && (pids[i] == waitpid(pids[i], &status, options)))
+        {   pids[i] = 0;
+            if (FLEET_EXITED != Agents[i].phase)
+                Agents[i].phase = FLEET_FAILED;
+        }
+    }
+}
+
+// Fails agents that have not started within timeout_us of the launch, or
+// not connected to a role within timeout_us of their connect command
+static void expire(const std::vector<Clock::time_point>& connect_sent, Clock::time_point start,
+                   long long timeout_us)
+{
+    for (int i = 0; i < Agent_count; i++)
+    {   FleetAgent& agent = Agents[i];
+        int phase = agent.phase;
+        if ((FLEET_STARTING == phase) && (elapsed_us(start) >= timeout_us))
+            set_phase(agent, phase, FLEET_FAILED);
+        else if (((FLEET_CONNECTING == phase) || (FLEET_ROLE_SET == phase)) &&
+                 (elapsed_us(connect_sent[i]) >= timeout_us))
+            set_phase(agent, phase, FLEET_FAILED);
+    }
+}
+
+static void print_progress(long long seconds)
+{
+    int phases[FLEET_EXITED + 1] = {0};
+    int errors = 0;
+    for (int i = 0; i < Agent_count; i++)
+    {   phases[Agents[i].phase]++;
+        errors += (ERROR_OFF != Agents[i].error);
+    }
+    printf("%4llds", seconds);
+    for (int p = 0; p <= FLEET_EXITED; p++)
+    {   if (phases[p])
+            printf("  %s %d", Phase_names[p], phases[p]);
+    }
+    printf("  errors %d\n", errors);
+    fflush(stdout);
+}
+
+static void print_percentiles(const char* label, std::vector<long long> values)
+{
+    if (values.empty())
+    {   printf("%-14s none\n", label);
+        return;
+    }
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    printf("%-14s n %-5zu p50 %9.1f ms  p99 %9.1f ms  max %9.1f ms\n", label, n,
+           values[(n - 1) / 2] / 1000.0,
+           values[(n * 99 + 99) / 100 - 1] / 1000.0,
+           values[n - 1] / 1000.0);
+}
+
+// Formats a duration in ms, or "-" if it was never measured
+static const char* format_ms(char* buf, size_t bufsz, long long us)
+{
+    if (us < 0)
+        snprintf(buf, bufsz, "-");
+    else
+        snprintf(buf, bufsz, "%.1f", us / 1000.0);
+    return buf;
+}
+
+static void print_report(void)
+{
+    std::vector<long long> connect;
+    std::vector<long long> role;
+    int errors = 0;
+    printf("\n%-5s %-8s %-20s %-10s %6s %12s %12s %6s %6s\n",
+           "Agent", "PID", "Client", "Phase", "State", "Connect ms", "Role ms", "Radios", "Error");
+    for (int i = 0; i < Agent_count; i++)
+    {   const FleetAgent& agent = Agents[i];
+        char connect_ms[32];
+        char role_ms[32];
+        long long connect_us = agent.connect_us;
+        long long role_us = agent.role_us;
+        if (connect_us >= 0)
+            connect.push_back(connect_us);
+        if (role_us >= 0)
+            role.push_back(role_us);
+        errors += (ERROR_OFF != agent.error);
+        printf("%-5d %-8d %-20s %-10s %6d %12s %12s %6d %6d\n",
+               i, agent.pid.load(), agent.client_name, Phase_names[agent.phase],
+               agent.connect_state.load(),
+               format_ms(connect_ms, sizeof(connect_ms), connect_us),
+               format_ms(role_ms, sizeof(role_ms), role_us),
+               agent.radios.load(), agent.error.load());
+    }
+    printf("\n");
+    print_percentiles("Connect", connect);
+    print_percentiles("Role connect", role);
+    printf("%-14s %d of %d agents connected to a role, %d reported errors\n",
+           "Summary", (int)role.size(), Agent_count, errors);
+}
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    Stop = 1;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: voisus-fleet -s <server ip> [-n agents] [-r role index] [-p name prefix]\n"
+                    "                    [-i stagger ms] [-d duration s] [-t timeout s] [-S DIS site]\n");
+    exit(2);
+}
+
+int main(int argc, char* argv[])
+{
+    const char* server_ip = NULL;
+    const char* prefix = "fleet";
+    int role = -1;
+    int stagger_ms = 100;
+    int duration_s = 30;
+    int timeout_s = 30;
+    int site = 1;
+    int opt;
+    while (-1 != (opt = getopt(argc, argv, "s:n:r:p:i:d:t:S:")))
+    {   switch (opt)
+        {   case 's': server_ip = optarg; break;
+            case 'n': Agent_count = atoi(optarg); break;
+            case 'r': role = atoi(optarg); break;
+            case 'p': prefix = optarg; break;
+            case 'i': stagger_ms = atoi(optarg); break;
+            case 'd': duration_s = atoi(optarg); break;
+            case 't': timeout_s = atoi(optarg); break;
+            case 'S': site = atoi(optarg); break;
+            default: usage();
+        }
+    }
+    if (!server_ip || (Agent_count <= 0))
+        usage();
+
+    void* shared = mmap(NULL, sizeof(FleetAgent) * Agent_count, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == shared)
+    {   perror("mmap");
+        return 1;
+    }
+    Agents = static_cast<FleetAgent*>(shared);
+    for (int i = 0; i < Agent_count; i++)
+    {   FleetAgent* agent = new (&Agents[i]) FleetAgent();
+        snprintf(agent->client_name, sizeof(agent->client_name), "%s-%d", prefix, i);
+        snprintf(agent->server_ip, sizeof(agent->server_ip), "%s", server_ip);
+        agent->role = role;
+        agent->dis.site = site;
+        agent->dis.app = i + 1;
+        agent->dis.entity = 1;
+        agent->dis.radio_offset = 0;
+        agent->connect_us = -1;
+        agent->role_us = -1;
+    }
+
+    // Fork before any thread is started so every agent begins clean
+    std::vector<pid_t> pids(Agent_count);
+    fflush(stdout);
+    for (int i = 0; i < Agent_count; i++)
+    {   pids[i] = fork();
+        if (0 == pids[i])
+            _exit(run_agent(i, Agents[i]));
+        if (-1 == pids[i])
+        {   perror("fork");
+            pids[i] = 0;
+            Agents[i].phase = FLEET_FAILED;
+        }
+    }
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    printf("Started %d agents against %s\n", Agent_count, server_ip);
+    Clock::time_point start = Clock::now();
+    std::vector<Clock::time_point> connect_sent(Agent_count, start);
+    for (int i = 0; (i < Agent_count) && !Stop; i++)
+    {   while ((FLEET_STARTING == Agents[i].phase) && pids[i] &&
+               (elapsed_us(start) < timeout_s * 1000000LL) && !Stop)
+        {   reap(pids, WNOHANG);
+            sleep_ms(1);
+        }
+        if (FLEET_READY == Agents[i].phase)
+        {   connect_sent[i] = Clock::now();
+            send_command(Agents[i], FLEET_CMD_CONNECT);
+        }
+        expire(connect_sent, start, timeout_s * 1000000LL);
+        sleep_ms(stagger_ms);
+    }
+
+    long long reported = -1;
+    while (!Stop && (elapsed_us(start) < duration_s * 1000000LL))
+    {   reap(pids, WNOHANG);
+        expire(connect_sent, start, timeout_s * 1000000LL);
+        long long seconds = elapsed_us(start) / 1000000;
+        if (seconds != reported)
+        {   print_progress(seconds);
+            reported = seconds;
+        }
+        sleep_ms(50);
+    }
+
+    for (int i = 0; i < Agent_count; i++)
+    {   if (pids[i])
+            send_command(Agents[i], FLEET_CMD_QUIT);
+    }
+    for (int i = 0; i < 100; i++)
+    {   reap(pids, WNOHANG);
+        if (std::count(pids.begin(), pids.end(), 0) == Agent_count)
+            break;
+        sleep_ms(50);
+    }
+    for (int i = 0; i < Agent_count; i++)
+    {   if (pids[i])
+            kill(pids[i], SIGKILL);
+    }
+    reap(pids, 0);
+
+    print_report();
+    munmap(shared, sizeof(FleetAgent) * Agent_count);
+    return 0;
+}
@@ -21,17 +21,41 @@
  * IN THE SOFTWARE.
  */
 
-#include "vrcc.h"
+#include "vrcc_timed.h"
+#include "activity.h"
+#include "api_stats.h"
+#include "call_storm.h"
+#include "campaign.h"
+#include "comm_plan.h"
+#include "dispatch.h"
+#include "inbox.h"
+#include "jammer_tracker.h"
+#include "json_writer.h"
+#include "meter.h"
+#include "operator_directory.h"
+#include "reactor.h"
+#include "retune.h"
+#include "snapshot.h"
+#include "vrcc_thread.h"
+#include "watch.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <fcntl.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
 #ifdef WIN32
     #define WIN32_LEAN_AND_MEAN
     #include <windows.h>
     #include <io.h>
     #include <winsock2.h>
 #else
+    #include <poll.h>
     #include <unistd.h>
 #endif
 
@@ -42,9 +66,37 @@
 int Current_radio;
 int Current_jammer;
 
+/// Line-buffered command input
+typedef struct {
+    int fd;                     ///< Descriptor commands are read from
+    int interactive;            ///< 1 if reading from a terminal, prompts are printed
+    int eof;                    ///< 1 once the descriptor is exhausted
+    size_t len;                 ///< Number of bytes in buf
+    char buf[4096];
+} INPUT_T;
+
+INPUT_T Input;
+
+/// Inline arguments remaining for the executing command
+const char* Args = "";
+
+/// 1 if output is JSON lines (--json) rather than text
+int Json_mode;
+JsonWriter Json;
+
+/// Jammer completions reported by the libvrcc thread, printed before the next command
+std::mutex Jammer_done_lock;
+std::vector<JammerStatus> Jammer_done;
+
+/// Invitations answered by the libvrcc thread, printed before the next command
+std::mutex Invitations_lock;
+std::vector<InboxEntry> Invitations;
+
+void activity(void);
 void connect(void);
 void disconnect(void);
 void help(void);
+void find_freq(void);
 void get_radio(void);
 void get_jammer(void);
 void get_radio_nets(void);
@@ -52,6 +104,13 @@ void get_jammer_nets(void);
 void get_radios(void);
 void get_jammers(void);
 void get_roles(void);
+void get_calls(void);
+void get_operators(void);
+void call_create(void);
+void call_storm(void);
+void inbox(void);
+void inbox_rule(void);
+void meters(void);
 void set_client_name(void);
 void set_ptt(void);
 void set_radio(void);
@@ -67,104 +126,343 @@ void jammer_start_recording(void);
 void jammer_start_replaying(void);
 void jammer_stop_recording(void);
 void jammer_stop_replaying(void);
+void jammer_wait(void);
+void campaign(void);
 void quit_app(void);
+void snapshot(void);
+void stats(void);
+void tune_all(void);
+void stats_reset(void);
+void timeline(void);
 void status(void);
+void wait(void);
+void watch(void);
 
 typedef void (*samplefunc)();
 
 typedef struct {
     const char* name;
-    const char* desc;
+    const char* args;           ///< Argument signature, [optional] <required>
+    const char* desc;           ///< Description, NULL for an alias
     samplefunc func;
 } COMMAND_T;
 
-COMMAND_T Commands[] = {{"connect", "Connect to server", connect},
-                        {"disconnect", "Disconnect from server", disconnect},
-                        {"help", "Print the command descriptions", help},
-                        {"get_radio", "Get current radio info", get_radio},
-                        {"get_jammer", "Get current jammer info", get_jammer},
-                        {"get_radio_nets", "Get nets assigned to current radio", get_radio_nets},
-                        {"get_jammer_nets", "Get nets assigned to current jammer", get_jammer_nets},
-                        {"get_radios", "Get info on all radios", get_radios},
-                        {"get_jammers", "Get info on all jammers", get_jammers},
-                        {"get_roles", "Get list of roles", get_roles},
-                        {"set_client_name", "Set client name", set_client_name},
-                        {"set_ptt", "Set PTT state (pressed or released)", set_ptt},
-                        {"set_radio", "Set the current radio by index", set_radio},
-                        {"set_jammer", "Set the current jammer by index", set_jammer},
-                        {"set_radio_net", "Set the net for a radio by index", set_radio_net},
-                        {"set_jammer_net", "Set the net for a jammer by index", set_jammer_net},
-                        {"set_role", "Set the role to use", set_role},
-                        {"set_jammer_enable", "Set transmit enable for current jammer", set_jammer_enable},
-                        {"set_rx_enable", "Set receive enable for current radio", set_rx_enable},
-                        {"set_tx_enable", "Set transmit enable for current radio", set_tx_enable},
-                        {"jammer_start_recording", "Begin recording on current jammer", jammer_start_recording},
-                        {"jammer_start_replaying", "Begin replaying on current jammer", jammer_start_replaying},
-                        {"jammer_stop_recording", "Stop recording on current jammer", jammer_stop_recording},
-                        {"jammer_stop_replaying", "Stop replaying on current jammer", jammer_stop_replaying},
-                        {"quit", "Quit the application", quit_app},
-                        {"status", "Get the current status", status},
-                        {NULL, NULL, NULL}};
+// Aliases come after the commands they name
+constexpr COMMAND_T Commands[] = {{"connect", "<ip>", "Connect to server", connect},
+                                  {"disconnect", "", "Disconnect from server", disconnect},
+                                  {"help", "", "Print the command descriptions", help},
+                                  {"find_freq", "<freq> [high]", "Find radios using a frequency or a range, e.g. 30.025M", find_freq},
+                                  {"get_radio", "", "Get current radio info", get_radio},
+                                  {"get_jammer", "", "Get current jammer info", get_jammer},
+                                  {"get_radio_nets", "", "Get nets assigned to current radio", get_radio_nets},
+                                  {"get_jammer_nets", "", "Get nets assigned to current jammer", get_jammer_nets},
+                                  {"get_radios", "", "Get info on all radios", get_radios},
+                                  {"get_jammers", "", "Get info on all jammers", get_jammers},
+                                  {"get_roles", "", "Get list of roles", get_roles},
+                                  {"get_calls", "[call]", "Get the endpoints and states of all calls or of one call by ID", get_calls},
+                                  {"get_operators", "[<term> [&& <term>]...]", "Get operators matching e.g. connected && !callactive && role=<name>", get_operators},
+                                  {"call_create", "[target]", "Create a call in the background and invite an endpoint, client name or role to it", call_create},
+                                  {"call_storm", "<calls> [per-second] [hold-ms] [target]", "Create calls at a rate, invite a target to each and time setup (default 10/s, 1000 ms, all operators)", call_storm},
+                                  {"inbox", "[accept|reject <call>]", "List kept call invitations, or answer one", inbox},
+                                  {"inbox_rule", "[clear|accept|reject|keep [from=<who>] [when=idle|busy]]", "List, clear or add rules that answer call invitations", inbox_rule},
+                                  {"set_client_name", "<name>", "Set client name", set_client_name},
+                                  {"set_ptt", "", "Set PTT state (pressed or released)", set_ptt},
+                                  {"set_radio", "<radio>", "Set the current radio by index", set_radio},
+                                  {"set_jammer", "<jammer>", "Set the current jammer by index", set_jammer},
+                                  {"set_radio_net", "[radio] <net>", "Set the net for a radio by index or ID", set_radio_net},
+                                  {"set_jammer_net", "[jammer] <net>", "Set the net for a jammer by index or ID", set_jammer_net},
+                                  {"set_role", "<role>", "Set the role to use", set_role},
+                                  {"set_jammer_enable", "enable|disable", "Set transmit enable for current jammer", set_jammer_enable},
+                                  {"set_rx_enable", "", "Set receive enable for current radio", set_rx_enable},
+                                  {"set_tx_enable", "", "Set transmit enable for current radio", set_tx_enable},
+                                  {"jammer_start_recording", "<seconds>", "Begin recording on current jammer", jammer_start_recording},
+                                  {"jammer_start_replaying", "loop|play", "Begin replaying on current jammer", jammer_start_replaying},
+                                  {"jammer_stop_recording", "", "Stop recording on current jammer", jammer_stop_recording},
+                                  {"jammer_stop_replaying", "", "Stop replaying on current jammer", jammer_stop_replaying},
+                                  {"jammer_wait", "idle|recording|replaying [seconds]", "Wait for the current jammer to reach a state (default 60 s)", jammer_wait},
+                                  {"campaign", "<file>|stop|status|wait [seconds]", "Run timed actions on many jammers from a campaign file", campaign},
+                                  {"meters", "[on|off]", "Print radio audio level meters, or turn metering on or off", meters},
+                                  {"quit", "", "Quit the application", quit_app},
+                                  {"snapshot", "save|restore <file>", "Save or restore the radio, headset and jammer configuration", snapshot},
+                                  {"stats", "", "Print libvrcc call latency statistics", stats},
+                                  {"stats_reset", "", "Clear libvrcc call latency statistics", stats_reset},
+                                  {"status", "", "Get the current status", status},
+                                  {"activity", "[seconds]", "Print radio receive/transmit duty cycles, default last 10 s", activity},
+                                  {"timeline", "[seconds]", "Print radio receive/transmit start and stop events", timeline},
+                                  {"tune_all", "<plan-file>", "Retune radios from a plan file and time each change", tune_all},
+                                  {"wait", "[ms]", "Wait for the role to connect, or for a number of ms", wait},
+                                  {"watch", "<domain> [ms] [frames]", "Print changes to radios, jammers, calls or status every ms (default 1000)", watch},
+                                  {"?", "", NULL, help},
+                                  {"q", "", NULL, quit_app},
+                                  {"exit", "", NULL, quit_app},
+                                  {"radios", "", NULL, get_radios},
+                                  {"jammers", "", NULL, get_jammers},
+                                  {"roles", "", NULL, get_roles},
+                                  {"calls", "[call]", NULL, get_calls},
+                                  {"operators", "[<term> [&& <term>]...]", NULL, get_operators},
+                                  {NULL, NULL, NULL, NULL}};
+
+constexpr size_t Command_slots = dispatch_size(sizeof(Commands) / sizeof(Commands[0]));
+constexpr PerfectHash<Command_slots> Command_hash = make_perfect_hash<Command_slots>(Commands);
+static_assert(Command_hash.ok, "Command names and aliases must be unique");
 
 ///////////////////////////////////////////////////////////////////////////////
 // Helper functions
 ///////////////////////////////////////////////////////////////////////////////
 
-void my_sleep(unsigned int ms)
+void fill_input(void)
 {
-#ifdef WIN32
-    Sleep(ms);
-#else
-    usleep(ms * 1000);
-#endif
+    if (Input.eof || (Input.len == sizeof(Input.buf)))
+        return;
+    int sz = read(Input.fd, Input.buf + Input.len, sizeof(Input.buf) - Input.len);
+    if (sz <= 0)
+        Input.eof = 1;
+    else
+        Input.len += sz;
+}
+
+// Pops the next complete line, or the unterminated last line at end of input
+int next_line(char* buf, size_t bufsz)
+{
+    char* newline = (char*)memchr(Input.buf, '\n', Input.len);
+    size_t len = newline ? newline - Input.buf : Input.len;
+    size_t used = newline ? len + 1 : len;
+    if (!newline && !(Input.eof && Input.len) && (Input.len < sizeof(Input.buf)))
+        return 0;
+    if ((len > 0) && ('\r' == Input.buf[len - 1]))
+        len--;
+    if (len >= bufsz)
+        len = bufsz - 1;
+    memcpy(buf, Input.buf, len);
+    buf[len] = '\0';
+    memmove(Input.buf, Input.buf + used, Input.len - used);
+    Input.len -= used;
+    return 1;
 }
 
 size_t get_input(char* buf, size_t bufsz)
 {
-    int sz = 0;
-    while (1)
-    {   sz = read(fileno(stdin), buf, bufsz);
-        if (-1 != sz)
-        {   buf[sz-1] = '\0';
-            return sz;
+    while (!next_line(buf, bufsz))
+    {   if (Input.eof)
+        {   buf[0] = '\0';
+            return 0;
         }
+        fill_input();
     }
-    return 0;
+    return strlen(buf) + 1;
+}
+
+/// @brief Gets the next argument of the executing command
+/// @details Arguments given inline after the command name are used first,
+/// otherwise the prompt is printed (on a terminal) and a line is read.
+/// @returns 1 if an argument was read, 0 at end of input
+int get_arg(char* buf, size_t bufsz, const char* prompt)
+{
+    Args += strspn(Args, " \t");
+    if (*Args)
+    {   size_t len = strcspn(Args, " \t");
+        snprintf(buf, bufsz, "%.*s", (int)len, Args);
+        Args += len;
+        return 1;
+    }
+    if (Input.interactive && !Json_mode)
+    {   printf("%s", prompt);
+        fflush(stdout);
+    }
+    return 0 != get_input(buf, bufsz);
+}
+
+/// Gets the number of inline arguments remaining for the executing command
+int count_args(void)
+{
+    int count = 0;
+    for (const char* p = Args + strspn(Args, " \t"); *p; p += strspn(p, " \t"))
+    {   p += strcspn(p, " \t");
+        count++;
+    }
+    return count;
+}
+
+/// @brief Prints a message, or a {"type": type, "text": ...} object in JSON mode
+/// @param type "message", "warning" or "error"
+void report(const char* type, const char* fmt, ...)
+{
+    char text[512];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(text, sizeof(text), fmt, args);
+    va_end(args);
+    if (Json_mode)
+    {   size_t len = strlen(text);
+        while (len && ('\n' == text[len - 1]))
+            text[--len] = '\0';
+        Json.begin(type).field("text", text).end();
+    }
+    else
+        printf("%s%s", (0 == strcmp(type, "warning")) ? "WARNING: " : "", text);
+}
+
+const char* jammer_state(int state);
+
+void print_jammer_done(void)
+{
+    std::vector<JammerStatus> done;
+    {   std::lock_guard<std::mutex> lock(Jammer_done_lock);
+        done.swap(Jammer_done);
+    }
+    for (size_t i = 0; i < done.size(); i++)
+    {   const char* what = (JAMMER_STATE_REPLAYING == done[i].previous) ? "replaying" :
+                           (JAMMER_STATE_RECORDING == done[i].previous) ? "recording" : "waiting";
+        if (Json_mode)
+            Json.begin("jammer_done")
+                .field("jammer", done[i].jammer)
+                .field("finished", what)
+                .field("duration_ms", done[i].duration_ms)
+                .field("elapsed_ms", done[i].elapsed_ms)
+                .end();
+        else
+            printf("Jammer %d finished %s (duration %d ms).\n", done[i].jammer, what, done[i].duration_ms);
+    }
+}
+
+void check_server(const Snapshot& snap)
+{
+    if (TARGET_CONNECT == snap.connection->connect_state)
+        report("warning", "Not connected to server.\n");
+}
+
+const char* inbox_action(int action)
+{
+    return (INBOX_ACCEPT == action) ? "accepted" : (INBOX_REJECT == action) ? "rejected" : "kept";
+}
+
+void print_invitations(void)
+{
+    std::vector<InboxEntry> entries;
+    {   std::lock_guard<std::mutex> lock(Invitations_lock);
+        entries.swap(Invitations);
+    }
+    for (size_t i = 0; i < entries.size(); i++)
+    {   const InboxEntry& entry = entries[i];
+        if (Json_mode)
+            Json.begin("invitation")
+                .field("call", entry.call_id)
+                .field("endpoint", entry.endpoint_id)
+                .field("from", entry.from)
+                .flag("busy", entry.busy)
+                .field("action", inbox_action(entry.action))
+                .field("rule", entry.rule)
+                .end();
+        else if (entry.rule >= 0)
+            printf("Invitation to call %s from %s: %s by rule %d.\n", entry.call_id.c_str(),
+                   entry.from.c_str(), inbox_action(entry.action), entry.rule);
+        else
+            printf("Invitation to call %s from %s: kept, answer with inbox accept|reject.\n",
+                   entry.call_id.c_str(), entry.from.c_str());
+    }
+}
+
+/// @brief Prints the blocking calls that finished since the last print
+/// @param running Receives the count of calls still running or waiting to run
+/// @returns count of calls printed
+size_t print_completions(size_t* running)
+{
+    std::vector<Completion> done;
+    size_t left = vrcc_completions(done);
+    if (running)
+        *running = left;
+    for (size_t i = 0; i < done.size(); i++)
+    {   if (Json_mode)
+            Json.begin("completion")
+                .field("id", (unsigned long long)done[i].id)
+                .field("what", done[i].what)
+                .field("result", done[i].result)
+                .field("queued_ms", done[i].queued_ms)
+                .field("run_ms", done[i].run_ms)
+                .end();
+        else
+            printf("Completed %s: %s (%.1f ms)\n", done[i].what.c_str(), done[i].result.c_str(),
+                   done[i].queued_ms + done[i].run_ms);
+    }
+    return done.size();
 }
 
-void check_server(void)
+void check_connected(const Snapshot& snap)
 {
-    if (TARGET_CONNECT == Network_ConnectState())
-        printf("WARNING: Not connected to server.\n");
+    if (ROLE_CONNECTED != snap.connection->connect_state)
+        report("warning", "Not connected to role.\n");
 }
 
-void check_connected(void)
+// Gets the most arguments a signature accepts, any number if it ends in ...
+int max_args(const char* signature)
 {
-    if (ROLE_CONNECTED != Network_ConnectState())
-        printf("WARNING: Not connected to role.\n");
+    int count = 0;
+    if (strstr(signature, "..."))
+        return INT_MAX;
+    for (const char* p = signature + strspn(signature, " "); *p; p += strspn(p, " "))
+    {   p += strcspn(p, " ");
+        count++;
+    }
+    return count;
 }
 
 void execute(const char* buf)
 {
     static char Last_cmd[1024];
-    COMMAND_T* cmd = Commands;
+    char line[sizeof(Last_cmd)];
     if ((0 == strlen(buf)) && (strlen(Last_cmd)))
         buf = Last_cmd;
-    while (cmd->name)
-    {   if (0 == strcmp(cmd->name, buf))
-        {   check_server();
-            check_connected();
-            cmd->func();
-            sprintf(Last_cmd, cmd->name);
-            return;
-        }
-        ++cmd;
+    snprintf(line, sizeof(line), "%s", buf);
+    size_t len = strcspn(line, " \t");
+    const COMMAND_T* cmd = Command_hash.find(Commands, line, len);
+    if (!cmd)
+    {   report("error", "Unknown command. Type help to see available commands.");
+        return;
+    }
+    Args = line + len;
+    if (Json_mode)
+        Json.begin("command").field("line", line).end();
+    if (count_args() > max_args(cmd->args))
+    {   report("error", "Usage: %.*s %s\n", (int)len, line, cmd->args);
+        Args = "";
+        return;
     }
-    printf("Unknown command. Type help to see available commands.");
+    {   SnapshotReader snap;
+        check_server(*snap);
+        check_connected(*snap);
+    }
+    snprintf(Last_cmd, sizeof(Last_cmd), "%s", line);
+    print_completions(NULL);
+    print_jammer_done();
+    print_invitations();
+    cmd->func();
+    Args = "";
 }
 
-void print_radio(int idx)
+void print_radio(const Snapshot& snap, int idx)
 {
+    const RadioTable& radios = *snap.radios;
+    int flags = (*snap.radio_flags)[idx];
+    if (Json_mode)
+    {   Json.begin("radio")
+            .field("index", idx)
+            .flag("current", idx == Current_radio)
+            .field("name", radios.name[idx])
+            .field("radio_type", radios.type[idx])
+            .field("net_id", radios.net_id_active[idx])
+            .field("net", radios.net_name_active[idx])
+            .flag("tx_enabled", flags & RADIO_TX_ENABLED)
+            .flag("rx_enabled", flags & RADIO_RX_ENABLED)
+            .flag("receiving", flags & RADIO_RECEIVING)
+            .flag("transmitting", flags & RADIO_TRANSMITTING)
+            .field("volume", radios.volume[idx])
+            .field("balance", radios.balance[idx])
+            .field("ptt", radios.ptt[idx])
+            .field("effects", radios.effects[idx])
+            .field("locks", (unsigned)radios.locks[idx])
+            .end();
+        return;
+    }
     printf("Radio index %d:%s\n"
            "    Active Net: %s\n"
            "    Transmit Enabled: %s\n"
@@ -173,11 +471,11 @@ void print_radio(int idx)
            "    Transmitting: %s\n",
            idx,
            (idx == Current_radio) ? " (*** Current ***)" : "",
-           Radio_NetNameActive(idx),
-           Radio_IsTransmitEnabled(idx) ? "true" : "false",
-           Radio_IsReceiveEnabled(idx) ? "true" : "false",
-           Radio_IsReceiving(idx) ? "true" : "false",
-           Radio_IsTransmitting(idx) ? "true" : "false");
+           radios.net_name_active[idx].c_str(),
+           (flags & RADIO_TX_ENABLED) ? "true" : "false",
+           (flags & RADIO_RX_ENABLED) ? "true" : "false",
+           (flags & RADIO_RECEIVING) ? "true" : "false",
+           (flags & RADIO_TRANSMITTING) ? "true" : "false");
 }
 
 const char* jammer_state(int state)
@@ -198,12 +496,24 @@ const char* jammer_state(int state)
     }
 }
 
-void print_jammer(int idx)
+void print_jammer(const Snapshot& snap, int idx)
 {
-    int active_net_idx;
-    for (active_net_idx = 0; active_net_idx < Jammer_NetListCount(Current_jammer); active_net_idx++)
-    {   if (!strcmp(Jammer_NetID(Current_jammer, active_net_idx), Jammer_NetIDActive(Current_jammer)))
-            break;
+    const JammerInfo& jammer = (*snap.jammers)[idx];
+    const char* active_net_name = "";
+    if (jammer.net_active >= 0)
+        active_net_name = jammer.nets[jammer.net_active].name.c_str();
+    if (Json_mode)
+    {   Json.begin("jammer")
+            .field("index", idx)
+            .flag("current", idx == Current_jammer)
+            .field("net_id", jammer.net_id_active)
+            .field("net", active_net_name)
+            .flag("transmitting", jammer.transmitting)
+            .field("state", jammer.state)
+            .field("progress", jammer.progress)
+            .field("duration_ms", jammer.duration_ms)
+            .end();
+        return;
     }
     printf("Jammer index %d:%s\n"
            "    Active Net Name: %s\n"
@@ -213,11 +523,23 @@ void print_jammer(int idx)
            "    Replay Duration: %d ms\n",
            idx,
            (idx == Current_jammer) ? "(*** Current ***)" : "",
-           Jammer_NetName(Current_jammer, active_net_idx),
-           Jammer_IsTransmitting(idx) ? "true":"false",
-           jammer_state(Jammer_RecordReplayState(idx)),
-           Jammer_RecordReplayProgress(idx),
-           Jammer_RecordReplayDurationMs(idx));
+           active_net_name,
+           jammer.transmitting ? "true":"false",
+           jammer_state(jammer.state),
+           jammer.progress,
+           jammer.duration_ms);
+}
+
+void print_radios(const Snapshot& snap)
+{
+    for (int i = 0; i < (int)snap.radios->size(); i++)
+        print_radio(snap, i);
+}
+
+void print_jammers(const Snapshot& snap)
+{
+    for (int i = 0; i < (int)snap.jammers->size(); i++)
+        print_jammer(snap, i);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -227,44 +549,82 @@ void print_jammer(int idx)
 void connect(void)
 {
     char ip[32];
-    printf("Enter IP address of server: ");
-    fflush(stdout);
-    get_input(ip, sizeof(ip));
-    Voisus_ConnectServer(ip);
+    get_arg(ip, sizeof(ip), "Enter IP address of server: ");
+    std::string target = ip;
+    // Blocks until the server answers, so the console carries on meanwhile
+    vrcc_submit("connect " + target, [target] {
+        Voisus_ConnectServer(target.c_str());
+        return std::string((STATUS_CONNECTED == Network_ConnectionStatus()) ? "connected" : "not connected");
+    });
 }
 
 void disconnect(void)
 {
-    Voisus_Disconnect();
+    vrcc_call([] { Voisus_Disconnect(); });
 }
 
 void help(void)
 {
-    COMMAND_T* cmd = Commands;
-    while (cmd->name)
-    {   printf("%-20s %s\n", cmd->name, cmd->desc);
-        cmd++;
+    const COMMAND_T* cmd = Commands;
+    for (; cmd->name && cmd->desc; cmd++)
+    {   if (Json_mode)
+            Json.begin("help").field("name", cmd->name).field("args", cmd->args)
+                .field("desc", cmd->desc).end();
+        else
+            printf("%-24s %-16s %s\n", cmd->name, cmd->args, cmd->desc);
+    }
+    if (!Json_mode)
+        printf("\nAliases:\n");
+    for (; cmd->name; cmd++)
+    {   const COMMAND_T* target = Commands;
+        while (target->func != cmd->func)
+            target++;
+        if (Json_mode)
+            Json.begin("alias").field("name", cmd->name).field("command", target->name).end();
+        else
+            printf("%-24s %s\n", cmd->name, target->name);
     }
 }
 
 void get_radio(void)
 {
-    if (Current_radio < Radio_ListCount())
-        print_radio(Current_radio);
+    SnapshotReader snap;
+    if ((Current_radio >= 0) && (Current_radio < (int)snap->radios->size()))
+        print_radio(*snap, Current_radio);
 }
 
 void get_jammer(void)
 {
-    if (Current_jammer < Jammer_ListCount())
-        print_jammer(Current_jammer);
+    SnapshotReader snap;
+    if ((Current_jammer >= 0) && (Current_jammer < (int)snap->jammers->size()))
+        print_jammer(*snap, Current_jammer);
 }
 
 void get_radio_nets(void)
 {
-    printf("Nets assigned to Radio %d:\n", Current_radio);
-    for (int i = 0; i < Radio_NetListCount(Current_radio); i++)
-    {   int current_net = !strcmp(Radio_NetID(Current_radio, i),
-                                  Radio_NetIDActive(Current_radio));
+    SnapshotReader snap;
+    if (!Json_mode)
+        printf("Nets assigned to Radio %d:\n", Current_radio);
+    if ((Current_radio < 0) || (Current_radio >= (int)snap->radios->size()))
+        return;
+    const std::vector<NetInfo>& nets = snap->radios->nets[Current_radio];
+    int net_active = snap->radios->net_active[Current_radio];
+    for (int i = 0; i < (int)nets.size(); i++)
+    {   const NetInfo& net = nets[i];
+        int current_net = (i == net_active);
+        if (Json_mode)
+        {   Json.begin("radio_net")
+                .field("radio", Current_radio)
+                .field("index", i)
+                .flag("current", current_net)
+                .field("id", net.id)
+                .field("name", net.name)
+                .field("frequency", net.frequency)
+                .field("waveform", net.waveform)
+                .flag("crypto_enabled", net.crypto_enabled)
+                .end();
+            continue;
+        }
         printf("Net index %d:%s\n"
                "    Name: %s\n"
                "    Frequency: %llu Hz\n"
@@ -272,267 +632,1183 @@ void get_radio_nets(void)
                "    Crypto enabled: %s\n",
                i,
                current_net ? " (*** Current ***)" : "",
-               Radio_NetName(Current_radio, i),
-               Radio_NetFrequency(Current_radio, i),
-               Radio_NetWaveform(Current_radio, i),
-               Radio_NetCryptoEnabled(Current_radio, i) ? "true" : "false");
+               net.name.c_str(),
+               net.frequency,
+               net.waveform.c_str(),
+               net.crypto_enabled ? "true" : "false");
     }
 }
 
 void get_jammer_nets(void)
 {
-    printf("Nets assigned to Jammer %d:\n", Current_jammer);
-    for (int i = 0; i < Jammer_NetListCount(Current_jammer); i++)
-    {   int current_net = !strcmp(Jammer_NetID(Current_jammer, i),
-                                  Jammer_NetIDActive(Current_jammer));
+    SnapshotReader snap;
+    if (!Json_mode)
+        printf("Nets assigned to Jammer %d:\n", Current_jammer);
+    if ((Current_jammer < 0) || (Current_jammer >= (int)snap->jammers->size()))
+        return;
+    const JammerInfo& jammer = (*snap->jammers)[Current_jammer];
+    for (int i = 0; i < (int)jammer.nets.size(); i++)
+    {   int current_net = (i == jammer.net_active);
+        if (Json_mode)
+        {   Json.begin("jammer_net")
+                .field("jammer", Current_jammer)
+                .field("index", i)
+                .flag("current", current_net)
+                .field("id", jammer.nets[i].id)
+                .field("name", jammer.nets[i].name)
+                .end();
+            continue;
+        }
         printf("Net index %d:%s\n"
                "    Name: %s\n"
                "    Net ID: %s\n",
                i,
                current_net ? " (*** Current ***)" : "",
-               Jammer_NetName(Current_jammer, i),
-               Jammer_NetID(Current_jammer, i)
+               jammer.nets[i].name.c_str(),
+               jammer.nets[i].id.c_str()
                );
     }
 }
 
+/// @brief Parses a frequency in Hz with an optional k, M or G suffix
+/// @returns 1 on success, 0 on error
+static int parse_frequency(const char* text, unsigned long long& hz)
+{
+    char* end;
+    double value = strtod(text, &end);
+    double scale = 1;
+    switch (*end)
+    {   case 'k': case 'K': scale = 1e3; end++; break;
+        case 'm': case 'M': scale = 1e6; end++; break;
+        case 'g': case 'G': scale = 1e9; end++; break;
+    }
+    if ((end == text) || *end || (value < 0))
+        return 0;
+    hz = (unsigned long long)(value * scale + 0.5);
+    return 1;
+}
+
+void find_freq(void)
+{
+    static const char* const uses[] = {"net", "rx active", "tx active"};
+    char lowstr[32];
+    char highstr[32];
+    unsigned long long low;
+    unsigned long long high;
+    get_arg(lowstr, sizeof(lowstr), "Enter frequency (Hz, or with k, M or G): ");
+    if (!parse_frequency(lowstr, low))
+    {   report("error", "Bad frequency %s.\n", lowstr);
+        return;
+    }
+    high = low;
+    if (count_args())
+    {   get_arg(highstr, sizeof(highstr), "");
+        if (!parse_frequency(highstr, high) || (high < low))
+        {   report("error", "Bad frequency range %s %s.\n", lowstr, highstr);
+            return;
+        }
+    }
+
+    SnapshotReader snap;
+    const RadioTable& radios = *snap->radios;
+    size_t first;
+    size_t count = radios.frequencies.range(low, high, first);
+    for (size_t i = first; i < first + count; i++)
+    {   const FreqEntry& entry = radios.frequencies.entries()[i];
+        const char* name = (entry.net >= 0) ? radios.nets[entry.radio][entry.net].name.c_str()
+                                            : radios.net_name_active[entry.radio].c_str();
+        if (Json_mode)
+        {   Json.begin("freq_match")
+                .field("frequency", entry.frequency)
+                .field("radio", entry.radio)
+                .field("net", entry.net)
+                .field("name", name)
+                .field("use", uses[entry.use])
+                .end();
+            continue;
+        }
+        printf("%llu Hz  radio %d  net %d (%s)  %s\n", entry.frequency, entry.radio,
+               entry.net, name, uses[entry.use]);
+    }
+    if (!Json_mode)
+        printf("Matches: %u\n", (unsigned)count);
+}
+
 void get_radios(void)
 {
-    for (int i = 0; i < Radio_ListCount(); i++)
-        print_radio(i);
+    SnapshotReader snap;
+    print_radios(*snap);
 }
 
 void get_jammers(void)
 {
-    for (int i = 0; i < Jammer_ListCount(); i++)
-        print_jammer(i);
+    SnapshotReader snap;
+    print_jammers(*snap);
+}
+
+const char* call_state(int state)
+{
+    switch (state)
+    {
+    case CALL_STATE_NONE:
+        return "None";
+    case CALL_STATE_LEAVING:
+        return "Leaving";
+    case CALL_STATE_CONNECTED:
+        return "Connected";
+    case CALL_STATE_SIGNALING:
+        return "Signaling";
+    case CALL_STATE_HOLDING:
+        return "Holding";
+    default:
+        return "Unknown";
+    }
+}
+
+void print_call(const CallInfo& call)
+{
+    if (!Json_mode)
+        printf("Call %s:\n", call.id.c_str());
+    for (size_t e = 0; e < call.endpoints.size(); e++)
+    {   const EndpointInfo& endpoint = call.endpoints[e];
+        if (Json_mode)
+            Json.begin("endpoint")
+                .field("call", call.id)
+                .field("id", endpoint.id)
+                .field("state", endpoint.state)
+                .field("state_name", call_state(endpoint.state))
+                .end();
+        else
+            printf("    Endpoint %s: %s\n", endpoint.id.c_str(), call_state(endpoint.state));
+    }
+}
+
+void get_calls(void)
+{
+    char id[64];
+    SnapshotReader snap;
+    if (count_args())
+    {   get_arg(id, sizeof(id), "");
+        // Looked up in the call table, without walking libvrcc's iterators
+        const CallInfo* call = snap->calls->find(id);
+        if (call)
+            print_call(*call);
+        else
+            report("error", "No call %s.\n", id);
+        return;
+    }
+    for (size_t c = 0; c < snap->calls->size(); c++)
+        print_call((*snap->calls)[c]);
+    if (!Json_mode && snap->calls->empty())
+        printf("No calls.\n");
+}
+
+void get_operators(void)
+{
+    char error[128];
+    OperatorFilter filter;
+    if (!filter.parse(Args, error, sizeof(error)))
+    {   report("error", "%s.\n", error);
+        return;
+    }
+    SnapshotReader snap;
+    const OperatorTable& operators = *snap->operators;
+    std::vector<uint64_t> mask;
+    size_t matches = filter.match(operators, mask);
+    for (size_t op = 0; op < operators.size(); op++)
+    {   if (!((mask[op >> 6] >> (op & 63)) & 1))
+            continue;
+        if (Json_mode)
+            Json.begin("operator")
+                .field("id", operators.field(OPERATOR_ID, op))
+                .field("clientname", operators.field(OPERATOR_CLIENTNAME, op))
+                .field("role", operators.field(OPERATOR_ROLE, op))
+                .field("hostname", operators.field(OPERATOR_HOSTNAME, op))
+                .flag("connected", operators.flag(OPERATOR_CONNECTED, op))
+                .flag("callactive", operators.flag(OPERATOR_CALLACTIVE, op))
+                .field("clientversion", operators.field(OPERATOR_CLIENTVERSION, op))
+                .field("serverversion", operators.field(OPERATOR_SERVERVERSION, op))
+                .end();
+        else
+            printf("    Operator %s:\t%s on %s, %s%s (client %s, server %s)\n",
+                   operators.field(OPERATOR_CLIENTNAME, op).c_str(), operators.field(OPERATOR_ROLE, op).c_str(),
+                   operators.field(OPERATOR_HOSTNAME, op).c_str(),
+                   operators.flag(OPERATOR_CONNECTED, op) ? "connected" : "disconnected",
+                   operators.flag(OPERATOR_CALLACTIVE, op) ? ", on a call" : "",
+                   operators.field(OPERATOR_CLIENTVERSION, op).c_str(), operators.field(OPERATOR_SERVERVERSION, op).c_str());
+    }
+    if (Json_mode)
+        Json.begin("operators").field("matches", (unsigned long long)matches)
+            .field("total", (unsigned long long)operators.size()).end();
+    else
+        printf("%u of %u operators match.\n", (unsigned int)matches, (unsigned int)operators.size());
+}
+
+// Adds the operators matching an endpoint ID, client name or role, or every
+// connected operator for "*"
+int add_storm_targets(const Snapshot& snap, const char* who, std::vector<StormTarget>& targets)
+{
+    const char* at = strchr(who, '@');
+    StormTarget target;
+    if (at)
+    {   // <number>@<endpoint> dials through a phone line endpoint
+        target.dial.assign(who, at - who);
+        target.endpoint_id = at + 1;
+        targets.push_back(target);
+        return 1;
+    }
+    const OperatorTable& operators = *snap.operators;
+    for (size_t op = 0; op < operators.size(); op++)
+    {   if ((!strcmp(who, "*") && operators.flag(OPERATOR_CONNECTED, op)) ||
+            (operators.field(OPERATOR_ID, op) == who) || (operators.field(OPERATOR_CLIENTNAME, op) == who) ||
+            (operators.field(OPERATOR_ROLE, op) == who))
+        {   target.endpoint_id = operators.field(OPERATOR_ID, op);
+            targets.push_back(target);
+        }
+    }
+    return !targets.empty();
+}
+
+void call_create(void)
+{
+    char who[128];
+    std::vector<StormTarget> targets;
+    if (count_args())
+    {   get_arg(who, sizeof(who), "");
+        SnapshotReader snap;
+        if (!add_storm_targets(*snap, who, targets))
+        {   report("error", "No endpoint matches %s.\n", who);
+            return;
+        }
+    }
+    vrcc_submit("call_create", [targets] {
+        std::string id = Call_Create();
+        for (size_t i = 0; !id.empty() && (i < targets.size()); i++)
+        {   if (targets[i].dial.empty())
+                Call_Invite(id.c_str(), targets[i].endpoint_id.c_str());
+            else
+                Call_Invite_Dial(id.c_str(), targets[i].endpoint_id.c_str(), targets[i].dial.c_str());
+        }
+        return id.empty() ? std::string("failed") : id;
+    });
+}
+
+void call_storm(void)
+{
+    char arg[128];
+    StormConfig config;
+    config.rate = 10;
+    config.hold_ms = 1000;
+    config.timeout_ms = 10000;
+    get_arg(arg, sizeof(arg), "Enter number of calls: ");
+    config.calls = atoi(arg);
+    if (count_args())
+    {   get_arg(arg, sizeof(arg), "");
+        config.rate = atof(arg);
+    }
+    if (count_args())
+    {   get_arg(arg, sizeof(arg), "");
+        config.hold_ms = atoi(arg);
+    }
+    snprintf(arg, sizeof(arg), "*");
+    if (count_args())
+        get_arg(arg, sizeof(arg), "");
+    if ((config.calls <= 0) || (config.rate <= 0) || (config.hold_ms < 0))
+    {   report("error", "Invalid entry\n");
+        return;
+    }
+    {   SnapshotReader snap;
+        check_connected(*snap);
+        if (!add_storm_targets(*snap, arg, config.targets))
+        {   report("error", "No endpoint matches %s.\n", arg);
+            return;
+        }
+    }
+
+    StormResult result;
+    call_storm_run(config, result);
+    print_invitations();
+    if (Json_mode)
+        Json.begin("call_storm")
+            .field("calls", config.calls)
+            .field("rate", config.rate)
+            .field("created", result.created)
+            .field("failed", result.failed)
+            .field("connected", result.connected)
+            .field("timed_out", result.timed_out)
+            .field("elapsed_ms", result.elapsed_ms)
+            .field("create_p50_ns", (unsigned long long)result.create.percentile(50.0))
+            .field("create_p99_ns", (unsigned long long)result.create.percentile(99.0))
+            .field("create_max_ns", (unsigned long long)result.create.max())
+            .field("connect_p50_ns", (unsigned long long)result.connect.percentile(50.0))
+            .field("connect_p99_ns", (unsigned long long)result.connect.percentile(99.0))
+            .field("connect_max_ns", (unsigned long long)result.connect.max())
+            .end();
+    else
+    {   printf("Created %d of %d calls in %.0f ms (%d failed), %d connected, %d timed out.\n",
+               result.created, config.calls, result.elapsed_ms, result.failed, result.connected, result.timed_out);
+        printf("    Call_Create:  p50 %.3f ms  p99 %.3f ms  max %.3f ms\n",
+               result.create.percentile(50.0) / 1e6, result.create.percentile(99.0) / 1e6, result.create.max() / 1e6);
+        printf("    Connected:    p50 %.3f ms  p99 %.3f ms  max %.3f ms\n",
+               result.connect.percentile(50.0) / 1e6, result.connect.percentile(99.0) / 1e6, result.connect.max() / 1e6);
+    }
+}
+
+void inbox(void)
+{
+    char answer[32];
+    char id[64];
+    if (count_args())
+    {   get_arg(answer, sizeof(answer), "");
+        get_arg(id, sizeof(id), "Enter call ID: ");
+        int action = !strcmp(answer, "accept") ? INBOX_ACCEPT : !strcmp(answer, "reject") ? INBOX_REJECT : INBOX_KEEP;
+        int found = 0;
+        if (INBOX_KEEP == action)
+            report("error", "Invalid entry\n");
+        else
+        {   vrcc_call([&] { found = inbox_answer(id, action); });
+            if (!found)
+                report("error", "No kept invitation to call %s.\n", id);
+        }
+        return;
+    }
+    std::vector<InboxEntry> pending;
+    vrcc_call([&] { pending = inbox_pending(); });
+    for (size_t i = 0; i < pending.size(); i++)
+    {   if (Json_mode)
+            Json.begin("inbox")
+                .field("call", pending[i].call_id)
+                .field("endpoint", pending[i].endpoint_id)
+                .field("from", pending[i].from)
+                .flag("busy", pending[i].busy)
+                .end();
+        else
+            printf("    Call %s from %s\n", pending[i].call_id.c_str(), pending[i].from.c_str());
+    }
+    if (!Json_mode && pending.empty())
+        printf("No kept invitations.\n");
+}
+
+void inbox_rule(void)
+{
+    std::vector<InboxRule> rules;
+    vrcc_call([&] { rules = inbox_rules(); });
+    const char* text = Args + strspn(Args, " \t");
+    if ((0 == strncmp(text, "clear", 5)) && !text[5 + strspn(text + 5, " \t")])
+        rules.clear();
+    else if (count_args())
+    {   char error[128];
+        InboxRule rule;
+        if (!inbox_parse_rule(Args, rule, error, sizeof(error)))
+        {   report("error", "%s.\n", error);
+            return;
+        }
+        rules.push_back(rule);
+    }
+    vrcc_call([&] { inbox_set_rules(rules); });
+    for (size_t r = 0; r < rules.size(); r++)
+    {   const char* when = (INBOX_IDLE == rules[r].when) ? "idle" : (INBOX_BUSY == rules[r].when) ? "busy" : "any";
+        const char* action = (INBOX_ACCEPT == rules[r].action) ? "accept" : (INBOX_REJECT == rules[r].action) ? "reject" : "keep";
+        const char* from = rules[r].from.empty() ? "*" : rules[r].from.c_str();
+        if (Json_mode)
+            Json.begin("inbox_rule").field("rule", (int)r).field("action", action).field("from", from).field("when", when).end();
+        else
+            printf("    Rule %d: %s from=%s when=%s\n", (int)r, action, from, when);
+    }
+    if (!Json_mode && rules.empty())
+        printf("No rules, invitations are kept.\n");
 }
 
 void get_roles(void)
 {
-    for (int i = 0; i < Role_ListCount(); i++)
-        printf("    Role %d:\t%s\n", i, Role_Name(i));
+    SnapshotReader snap;
+    for (int i = 0; i < (int)snap->roles->size(); i++)
+    {   const NamedInfo& role = (*snap->roles)[i];
+        if (Json_mode)
+            Json.begin("role").field("index", i).field("id", role.id).field("name", role.name).end();
+        else
+            printf("    Role %d:\t%s\n", i, role.name.c_str());
+    }
 }
 
 void set_client_name(void)
 {
     char name[32];
-    printf("Enter client name: ");
-    fflush(stdout);
-    get_input(name, sizeof(name));
-    Network_SetClientName(name);
+    get_arg(name, sizeof(name), "Enter client name: ");
+    vrcc_call([&] { Network_SetClientName(name); });
 }
 
 void set_ptt(void)
 {
-    printf("Setting Push-To-Talk state to %s.\n",
-           PTT_GetPressed() ? "Released" : "Pressed");
-    PTT_SetPressed(!PTT_GetPressed());
+    vrcc_call([] {
+        report("message", "Setting Push-To-Talk state to %s.\n",
+               PTT_GetPressed() ? "Released" : "Pressed");
+        PTT_SetPressed(!PTT_GetPressed());
+    });
+}
+
+/// @brief Parses a radio or jammer index
+/// @returns index, or -1 if the argument is not a number or is negative
+static int parse_index(const char* arg)
+{
+    char* end;
+    long idx = strtol(arg, &end, 10);
+    if ((end == arg) || *end || (idx < 0) || (idx > INT_MAX))
+        return -1;
+    return (int)idx;
 }
 
 void set_radio(void)
 {
     char idxstr[32];
-    printf("Enter radio number (see: get_radios): ");
-    fflush(stdout);
-    get_input(idxstr, sizeof(idxstr));
-    int idx = atoi(idxstr);
-    if (idx < Radio_ListCount())
+    get_arg(idxstr, sizeof(idxstr), "Enter radio number (see: get_radios): ");
+    int idx = parse_index(idxstr);
+    SnapshotReader snap;
+    if ((idx >= 0) && (idx < (int)snap->radios->size()))
     {   Current_radio = idx;
-        get_radios();
+        print_radios(*snap);
     }
     else
-        printf("Bad radio index. Current radio index is %d.\n", Current_radio);
+        report("error", "Bad radio index. Current radio index is %d.\n", Current_radio);
 }
 
 void set_jammer(void)
 {
     char idxstr[32];
-    printf("Enter jammer number (see: get_jammers): ");
-    fflush(stdout);
-    get_input(idxstr, sizeof(idxstr));
-    int idx = atoi(idxstr);
-    if (idx < Jammer_ListCount())
+    get_arg(idxstr, sizeof(idxstr), "Enter jammer number (see: get_jammers): ");
+    int idx = parse_index(idxstr);
+    SnapshotReader snap;
+    if ((idx >= 0) && (idx < (int)snap->jammers->size()))
     {   Current_jammer = idx;
-        get_jammers();
+        print_jammers(*snap);
     }
     else
-        printf("Bad jammer index. Current jammer index is %d.\n", Current_jammer);
+        report("error", "Bad jammer index. Current jammer index is %d.\n", Current_jammer);
+}
+
+/// @brief Parses a net argument, either a net index or a net ID
+/// @returns net index, or -1 if the net ID is not assigned
+static int parse_net(const char* arg, const NetIndex* index)
+{
+    size_t len = strlen(arg);
+    if ((len < 10) && (strspn(arg, "0123456789") == len))
+        return atoi(arg);
+    return index ? index->find(arg) : -1;
 }
 
 void set_radio_net(void)
 {
-    char idxstr[32];
-    if (0 == Radio_ListCount())
-    {   printf("No radios.");
-        return;
+    char idxstr[64];
+    int radio = Current_radio;
+    {   SnapshotReader snap;
+        if (snap->radios->empty())
+        {   report("error", "No radios.\n");
+            return;
+        }
     }
-    printf("Enter net number (see: get_radio_nets): ");
-    fflush(stdout);
-    get_input(idxstr, sizeof(idxstr));
-    int idx = atoi(idxstr);
-    if (idx < Radio_NetListCount(Current_radio))
-        Radio_SetNet(Current_radio, idx);
-    else
-        printf("Bad net index.\n");
+    // Inline "set_radio_net <radio> <net>" names the radio too
+    if (count_args() >= 2)
+    {   get_arg(idxstr, sizeof(idxstr), "");
+        radio = parse_index(idxstr);
+    }
+    {   SnapshotReader snap;
+        if ((radio < 0) || (radio >= (int)snap->radios->size()))
+        {   report("error", "Bad radio index.\n");
+            return;
+        }
+    }
+    get_arg(idxstr, sizeof(idxstr), "Enter net number or ID (see: get_radio_nets): ");
+    int idx;
+    {   SnapshotReader snap;
+        const RadioTable& radios = *snap->radios;
+        idx = parse_net(idxstr, (radio >= 0) && (radio < (int)radios.size()) ? &radios.net_index[radio] : NULL);
+    }
+    vrcc_call([=] {
+        if ((idx >= 0) && (idx < Radio_NetListCount(radio)))
+            Radio_SetNet(radio, idx);
+        else
+            report("error", "Bad net index.\n");
+    });
 }
 
 void set_jammer_net(void)
 {
-    char idxstr[32];
-    if (0 == Jammer_ListCount())
-    {   printf("No jammers.");
-        return;
+    char idxstr[64];
+    int jammer = Current_jammer;
+    {   SnapshotReader snap;
+        if (snap->jammers->empty())
+        {   report("error", "No jammers.\n");
+            return;
+        }
     }
-    printf("Enter net number (see: get_jammer_nets): ");
-    fflush(stdout);
-    get_input(idxstr, sizeof(idxstr));
-    int idx = atoi(idxstr);
-    if (idx < Jammer_NetListCount(Current_jammer))
-    {   const char* netID = Jammer_NetID(Current_jammer, idx);
-        Jammer_SetNetID(Current_jammer, netID);
+    // Inline "set_jammer_net <jammer> <net>" names the jammer too
+    if (count_args() >= 2)
+    {   get_arg(idxstr, sizeof(idxstr), "");
+        jammer = parse_index(idxstr);
     }
-    else
-        printf("Bad net index.\n");
+    {   SnapshotReader snap;
+        if ((jammer < 0) || (jammer >= (int)snap->jammers->size()))
+        {   report("error", "Bad jammer index.\n");
+            return;
+        }
+    }
+    get_arg(idxstr, sizeof(idxstr), "Enter net number or ID (see: get_jammer_nets): ");
+    int idx;
+    {   SnapshotReader snap;
+        const std::vector<JammerInfo>& jammers = *snap->jammers;
+        idx = parse_net(idxstr, (jammer >= 0) && (jammer < (int)jammers.size()) ? &jammers[jammer].net_index : NULL);
+    }
+    vrcc_call([=] {
+        if ((idx >= 0) && (idx < Jammer_NetListCount(jammer)))
+        {   const char* netID = Jammer_NetID(jammer, idx);
+            Jammer_SetNetID(jammer, netID);
+        }
+        else
+            report("error", "Bad net index.\n");
+    });
 }
 
 void set_role(void)
 {
     char idxstr[32];
-    printf("Enter role number (see: get_roles): ");
-    fflush(stdout);
-    get_input(idxstr, sizeof(idxstr));
-    int idx = atoi(idxstr);
-    const char* role_id = Role_Id(idx);
-    if (strlen(role_id))
-    {   Role_SetRole(role_id);
-        printf("Set role to %s.\n", Role_Name(idx));
+    get_arg(idxstr, sizeof(idxstr), "Enter role number (see: get_roles): ");
+    int idx = parse_index(idxstr);
+    {   SnapshotReader snap;
+        if ((idx < 0) || (idx >= (int)snap->roles->size()))
+        {   report("error", "Unknown role.\n");
+            return;
+        }
     }
-    else
-        printf("Unknown role.\n");
+    vrcc_call([=] {
+        const char* role_id = Role_Id(idx);
+        if (strlen(role_id))
+        {   Role_SetRole(role_id);
+            report("message", "Set role to %s.\n", Role_Name(idx));
+        }
+        else
+            report("error", "Unknown role.\n");
+    });
 }
 
 void set_jammer_enable(void)
 {
     char enablestr[32];
-    printf("Enter 'enable' to enable the selected jammer, or 'disable' to disable the selected jammer: ");
-    fflush(stdout);
-    get_input(enablestr, sizeof(enablestr));
+    get_arg(enablestr, sizeof(enablestr),
+            "Enter 'enable' to enable the selected jammer, or 'disable' to disable the selected jammer: ");
+    int jammer = Current_jammer;
     if (0 == strcmp(enablestr, "enable"))
-    {   Jammer_SetEnable(Current_jammer, 1);
-        printf("Jammer %d enabled\n", Current_jammer);
+    {   vrcc_call([=] { Jammer_SetEnable(jammer, 1); });
+        report("message", "Jammer %d enabled\n", jammer);
     }
     else if (0 == strcmp(enablestr, "disable"))
-    {   Jammer_SetEnable(Current_jammer, 0);
-        printf("Jammer %d disabled\n", Current_jammer);
+    {   vrcc_call([=] { Jammer_SetEnable(jammer, 0); });
+        report("message", "Jammer %d disabled\n", jammer);
     }else
-        printf("Invalid entry\n");
+        report("error", "Invalid entry\n");
 }
 
 
 void set_rx_enable(void)
 {
-    if (Current_radio >= Radio_ListCount())
-        return;
-    printf("Setting Receive Enable of Radio %d to %s.\n",
-           Current_radio,
-           Radio_IsReceiveEnabled(Current_radio) ? "Disabled" : "Enabled");
-    Radio_SetReceiveEnabled(Current_radio,
-                            !Radio_IsReceiveEnabled(Current_radio));
+    int radio = Current_radio;
+    vrcc_call([=] {
+        if (radio >= Radio_ListCount())
+            return;
+        report("message", "Setting Receive Enable of Radio %d to %s.\n",
+               radio,
+               Radio_IsReceiveEnabled(radio) ? "Disabled" : "Enabled");
+        Radio_SetReceiveEnabled(radio, !Radio_IsReceiveEnabled(radio));
+    });
 }
 
 void set_tx_enable(void)
 {
-    if (Current_radio >= Radio_ListCount())
-        return;
-    printf("Setting Transmit Enable of Radio %d to %s.\n",
-           Current_radio,
-           Radio_IsTransmitEnabled(Current_radio) ? "Disabled" : "Enabled");
-    Radio_SetTransmitEnabled(Current_radio,
-                             !Radio_IsTransmitEnabled(Current_radio));
+    int radio = Current_radio;
+    vrcc_call([=] {
+        if (radio >= Radio_ListCount())
+            return;
+        report("message", "Setting Transmit Enable of Radio %d to %s.\n",
+               radio,
+               Radio_IsTransmitEnabled(radio) ? "Disabled" : "Enabled");
+        Radio_SetTransmitEnabled(radio, !Radio_IsTransmitEnabled(radio));
+    });
 }
 
 void jammer_start_recording(void)
 {
-    printf("Enter how long (in seconds) you'd like to record.(Max 30 Seconds): ");
     char timestr[32];
-    fflush(stdout);
-    get_input(timestr, sizeof(timestr));
+    get_arg(timestr, sizeof(timestr),
+            "Enter how long (in seconds) you'd like to record.(Max 30 Seconds): ");
     int time = atoi(timestr);
     if (time > 30 || time < 0)
-    {   printf("Invalid entry\n");
+    {   report("error", "Invalid entry\n");
         return;
     }
-    Jammer_StartRecording(Current_jammer, time);
+    int jammer = Current_jammer;
+    vrcc_call([=] {
+        Jammer_StartRecording(jammer, time);
+        jammer_track_start(jammer);
+    });
 }
 
 void jammer_stop_recording(void)
 {
-    Jammer_StopRecording(Current_jammer);
+    int jammer = Current_jammer;
+    vrcc_call([=] { Jammer_StopRecording(jammer); });
 }
 
 void jammer_start_replaying(void)
 {
-    printf("Enter 'loop' to loop recording, or 'play' to play normally: ");
     char optstr[32];
-    fflush(stdout);
-    get_input(optstr, sizeof(optstr));
+    get_arg(optstr, sizeof(optstr), "Enter 'loop' to loop recording, or 'play' to play normally: ");
+    int jammer = Current_jammer;
     if (0 == strcmp(optstr, "loop"))
-        Jammer_StartReplaying(Current_jammer, 1);
+        vrcc_call([=] {
+            Jammer_StartReplaying(jammer, 1);
+            jammer_track_start(jammer);
+        });
     else if (0 == strcmp(optstr, "play"))
-        Jammer_StartReplaying(Current_jammer, 0);
+        vrcc_call([=] {
+            Jammer_StartReplaying(jammer, 0);
+            jammer_track_start(jammer);
+        });
     else
-        printf("Invalid entry\n");
+        report("error", "Invalid entry\n");
 }
 
 void jammer_stop_replaying(void)
 {
-    Jammer_StopReplaying(Current_jammer);
+    int jammer = Current_jammer;
+    vrcc_call([=] { Jammer_StopReplaying(jammer); });
+}
+
+void jammer_wait(void)
+{
+    char statestr[32];
+    char secstr[32];
+    get_arg(statestr, sizeof(statestr), "Enter idle, recording or replaying: ");
+    int state;
+    if (0 == strcmp(statestr, "idle"))
+        state = JAMMER_STATE_IDLE;
+    else if (0 == strcmp(statestr, "recording"))
+        state = JAMMER_STATE_RECORDING;
+    else if (0 == strcmp(statestr, "replaying"))
+        state = JAMMER_STATE_REPLAYING;
+    else
+    {   report("error", "Invalid entry\n");
+        return;
+    }
+    int seconds = 60;
+    if (count_args())
+    {   get_arg(secstr, sizeof(secstr), "");
+        seconds = atoi(secstr);
+    }
+    int jammer = Current_jammer;
+    std::future<JammerStatus> done;
+    vrcc_call([&] { done = jammer_await(jammer, state, seconds * 1000); });
+    JammerStatus status = done.get();
+    print_jammer_done();
+    if (status.timed_out)
+        report("error", "Timed out waiting for jammer %d to reach %s.\n", jammer, statestr);
+    else if (-1 == status.state)
+        report("error", "No jammer %d.\n", jammer);
+    else
+        report("message", "Jammer %d is %s after %.0f ms.\n", jammer, statestr, status.elapsed_ms);
+}
+
+void print_campaign(const CampaignStatus& status)
+{
+    if (Json_mode)
+        Json.begin("campaign")
+            .flag("running", status.running)
+            .field("actions", (unsigned)status.actions)
+            .field("fired", (unsigned)status.fired)
+            .field("elapsed_ms", status.elapsed_ms)
+            .field("late_p50_ms", status.late_p50_ms)
+            .field("late_p99_ms", status.late_p99_ms)
+            .field("late_max_ms", status.late_max_ms)
+            .end();
+    else
+        printf("Campaign %s: %u of %u actions fired in %.0f ms, late by p50 %.2f ms, p99 %.2f ms, max %.2f ms\n",
+               status.running ? "running" : "done", (unsigned)status.fired, (unsigned)status.actions,
+               status.elapsed_ms, status.late_p50_ms, status.late_p99_ms, status.late_max_ms);
+}
+
+void campaign(void)
+{
+    char arg[256];
+    char error[512];
+    CampaignStatus status;
+    get_arg(arg, sizeof(arg), "Enter campaign file, stop, status or wait: ");
+    if (0 == strcmp(arg, "stop"))
+        vrcc_call([&] { campaign_stop(); status = campaign_status(); });
+    else if (0 == strcmp(arg, "wait"))
+    {   int seconds = 60;
+        if (count_args())
+        {   get_arg(arg, sizeof(arg), "");
+            seconds = atoi(arg);
+        }
+        // The campaign runs on the libvrcc thread; just look in on it
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+        do
+        {   std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            vrcc_call([&] { status = campaign_status(); });
+        } while (status.running && (std::chrono::steady_clock::now() < end));
+        print_jammer_done();
+        if (status.running)
+            report("error", "Timed out waiting for the campaign.\n");
+    }
+    else if (0 == strcmp(arg, "status"))
+        vrcc_call([&] { status = campaign_status(); });
+    else
+    {   std::vector<CampaignAction> actions;
+        {   SnapshotReader snap;
+            check_connected(*snap);
+            if (!campaign_load(arg, *snap, actions, error, sizeof(error)))
+            {   report("error", "%s\n", error);
+                return;
+            }
+        }
+        vrcc_call([&] { campaign_start(actions); status = campaign_status(); });
+    }
+    print_campaign(status);
 }
 
 void quit_app(void)
 {
-    VRCC_Shutdown();
+    vrcc_thread_stop();
     exit(0);
 }
 
+bool by_total_time(const ApiStat* a, const ApiStat* b)
+{
+    return a->latency.total() > b->latency.total();
+}
+
+void stats(void)
+{
+#ifndef VOISUS_API_STATS
+    report("warning", "Call statistics are disabled in this build (see VOISUS_API_STATS).\n");
+#endif
+    std::vector<const ApiStat*> sorted;
+    for (int i = 0; i < api_stat_count(); i++)
+        sorted.push_back(api_stat_get(i));
+    std::sort(sorted.begin(), sorted.end(), by_total_time);
+    if (Json_mode)
+    {   for (size_t i = 0; i < sorted.size(); i++)
+        {   const LatencyHistogram& latency = sorted[i]->latency;
+            if (latency.count())
+                Json.begin("api_stat")
+                    .field("function", sorted[i]->name)
+                    .field("calls", (unsigned long long)latency.count())
+                    .field("p50_ns", (unsigned long long)latency.percentile(50.0))
+                    .field("p99_ns", (unsigned long long)latency.percentile(99.0))
+                    .field("p999_ns", (unsigned long long)latency.percentile(99.9))
+                    .field("max_ns", (unsigned long long)latency.max())
+                    .end();
+        }
+        for (int d = 0; d < DOMAIN_COUNT; d++)
+            Json.begin("refresh").field("domain", refresh_domain_name(d))
+                .field("count", (unsigned long long)refresh_count(d)).end();
+        return;
+    }
+    printf("%-32s %10s %10s %10s %10s %10s\n",
+           "Function", "Calls", "p50 us", "p99 us", "p999 us", "max us");
+    for (size_t i = 0; i < sorted.size(); i++)
+    {   const LatencyHistogram& latency = sorted[i]->latency;
+        if (0 == latency.count())
+            continue;
+        printf("%-32s %10llu %10.2f %10.2f %10.2f %10.2f\n",
+               sorted[i]->name,
+               (unsigned long long)latency.count(),
+               latency.percentile(50.0) / 1000.0,
+               latency.percentile(99.0) / 1000.0,
+               latency.percentile(99.9) / 1000.0,
+               latency.max() / 1000.0);
+    }
+    printf("\nDomain refreshes:\n");
+    for (int d = 0; d < DOMAIN_COUNT; d++)
+        printf("    %-14s %lu\n", refresh_domain_name(d), refresh_count(d));
+}
+
+void stats_reset(void)
+{
+    vrcc_call(api_stats_reset);
+    report("message", "Call statistics cleared.\n");
+}
+
 void status(void)
 {
+    SnapshotReader snap;
+    const ConnectionInfo& conn = *snap->connection;
+    if (Json_mode)
+    {   Json.begin("status")
+            .field("target_ip", conn.target_ip)
+            .field("client_name", conn.client_name)
+            .field("connect_state", conn.connect_state)
+            .flag("connected", conn.connection_status == STATUS_CONNECTED)
+            .field("role", conn.role_name_active)
+            .flag("ptt", conn.ptt_pressed)
+            .end();
+        return;
+    }
     printf("Voisus Server IP Address: %s\n"
            "Client Name: %s\n"
            "Connection State: %d\n"
            "Connection Status: %s\n"
            "Role: %s\n",
-           Network_TargetIP(),
-           Network_ClientName(),
-           Network_ConnectState(),
-           Network_ConnectionStatus() == STATUS_CONNECTED ? "Connected" : "Disconnected",
-           Role_NameActive());
-}
-
-int input_available()
-{
-#ifndef WIN32
-    struct timeval tv;
-    fd_set fds;
-    tv.tv_sec = 0;
-    tv.tv_usec = 0;
-    FD_ZERO(&fds);
-    FD_SET(STDIN_FILENO, &fds);
-    select(STDIN_FILENO+1, &fds, NULL, NULL, &tv);
-    return FD_ISSET(0, &fds);
+           conn.target_ip.c_str(),
+           conn.client_name.c_str(),
+           conn.connect_state,
+           conn.connection_status == STATUS_CONNECTED ? "Connected" : "Disconnected",
+           conn.role_name_active.c_str());
+}
+
+void wait(void)
+{
+    char msstr[32];
+    if (count_args())
+    {   get_arg(msstr, sizeof(msstr), "");
+        std::this_thread::sleep_for(std::chrono::milliseconds(atoi(msstr)));
+        return;
+    }
+    // Scripts use this after set_role, before touching radios
+    for (int i = 0; i < 1000; i++)
+    {   {   SnapshotReader snap;
+            if (ROLE_CONNECTED == snap->connection->connect_state)
+                return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    report("error", "Timed out waiting for the role to connect.\n");
+}
+
+void meters(void)
+{
+    char onoff[32];
+    if (count_args())
+    {   get_arg(onoff, sizeof(onoff), "");
+        if (strcmp(onoff, "on") && strcmp(onoff, "off"))
+        {   report("error", "Expected on or off.\n");
+            return;
+        }
+        int enable = (0 == strcmp(onoff, "on"));
+        vrcc_call([=] { meter_enable(enable); });
+        return;
+    }
+    std::shared_ptr<const MeterTable> table = meter_read();
+    if (!table)
+    {   report("message", "Metering is off, use \"meters on\".\n");
+        return;
+    }
+    if (!Json_mode)
+        printf("Radio  Level   Peak    RMS  Clips  Alarms\n");
+    for (int i = 0; i < (int)table->size(); i++)
+    {   int alarms = table->alarms[i];
+        if (Json_mode)
+        {   Json.begin("meter")
+                .field("radio", i)
+                .field("level", table->level[i])
+                .field("peak", table->peak[i])
+                .field("rms", table->rms[i])
+                .field("clips", table->clips[i])
+                .flag("clipping", alarms & METER_CLIPPING)
+                .flag("silent", alarms & METER_SILENT)
+                .end();
+            continue;
+        }
+        printf("%5d  %5.3f  %5.3f  %5.3f  %5u  %s%s\n", i, table->level[i], table->peak[i],
+               table->rms[i], table->clips[i],
+               (alarms & METER_CLIPPING) ? "CLIPPING " : "",
+               (alarms & METER_SILENT) ? "SILENT" : "");
+    }
+}
+
+void snapshot(void)
+{
+    char action[32];
+    char path[256];
+    char error[256];
+    get_arg(action, sizeof(action), "Enter save or restore: ");
+    get_arg(path, sizeof(path), "Enter file: ");
+    if (0 == strcmp(action, "save"))
+    {   std::vector<char> image;
+        vrcc_call([&] { comm_plan_capture(image); });
+        if (!comm_plan_write(path, image))
+        {   report("error", "Cannot write %s.\n", path);
+            return;
+        }
+        const CommPlanHeader* header = (const CommPlanHeader*)&image[0];
+        report("message", "Saved %u radios and %u jammers to %s.\n",
+               (unsigned)header->radio_count, (unsigned)header->jammer_count, path);
+    }
+    else if (0 == strcmp(action, "restore"))
+    {   size_t size = 0;
+        const void* image = comm_plan_map(path, size);
+        if (!image)
+        {   report("error", "Cannot read %s.\n", path);
+            return;
+        }
+        if (!comm_plan_check(image, size, error, sizeof(error)))
+        {   report("error", "%s\n", error);
+            comm_plan_unmap(image, size);
+            return;
+        }
+        int renamed = 0;
+        int radios = 0;
+        vrcc_call([&] {
+            renamed = comm_plan_apply(image, size);
+            radios = Radio_ListCount();
+        });
+        const CommPlanHeader* header = (const CommPlanHeader*)image;
+        if ((int)header->radio_count != radios)
+            report("warning", "Plan has %u radios, the role has %d.\n", (unsigned)header->radio_count, radios);
+        if (renamed)
+            report("warning", "%d radios have different names than when saved.\n", renamed);
+        report("message", "Restored %s.\n", path);
+        comm_plan_unmap(image, size);
+    }
+    else
+        report("error", "Expected save or restore.\n");
+}
+
+/// Gets the optional [seconds] argument as a window start on the sampler's clock
+static uint64_t activity_since(void)
+{
+    char secstr[32];
+    double seconds = 10;
+    if (count_args())
+    {   get_arg(secstr, sizeof(secstr), "");
+        seconds = atof(secstr);
+    }
+    uint64_t window_us = (uint64_t)(seconds * 1e6);
+    uint64_t now = activity_now_us();
+    return (window_us < now) ? now - window_us : 0;
+}
+
+void activity(void)
+{
+    uint64_t since = activity_since();
+    std::vector<ActivityDuty> duty;
+    uint64_t window_us;
+    {   SnapshotReader snap;
+        window_us = activity_duty(since, *snap->radio_flags, duty);
+    }
+    if (!Json_mode)
+        printf("Radio activity over the last %.1f s:\n"
+               "Radio  RX duty  RX count  TX duty  TX count\n", window_us / 1e6);
+    for (int i = 0; i < (int)duty.size(); i++)
+    {   if (Json_mode)
+        {   Json.begin("activity")
+                .field("radio", i)
+                .field("window_ms", window_us / 1e3)
+                .field("rx_duty", duty[i].rx)
+                .field("rx_count", duty[i].rx_count)
+                .field("tx_duty", duty[i].tx)
+                .field("tx_count", duty[i].tx_count)
+                .end();
+            continue;
+        }
+        printf("%5d  %6.1f%%  %8u  %6.1f%%  %8u\n",
+               i, duty[i].rx * 100, duty[i].rx_count, duty[i].tx * 100, duty[i].tx_count);
+    }
+}
+
+void timeline(void)
+{
+    uint64_t since = activity_since();
+    uint64_t cursor = 0;
+    std::vector<ActivityEvent> events;
+    uint64_t lost = activity_read(cursor, events);
+    if (lost)
+        report("warning", "%llu older events were overwritten.\n", (unsigned long long)lost);
+    for (size_t i = 0; i < events.size(); i++)
+    {   const ActivityEvent& event = events[i];
+        if (event.time_us < since)
+            continue;
+        if (Json_mode)
+        {   Json.begin("activity_event")
+                .field("time_ms", event.time_us / 1e3)
+                .field("radio", event.radio)
+                .field("signal", event.transmit ? "tx" : "rx")
+                .flag("on", event.on)
+                .end();
+            continue;
+        }
+        printf("%12.3f ms  radio %d  %s %s\n", event.time_us / 1e3, event.radio,
+               event.transmit ? "tx" : "rx", event.on ? "start" : "stop");
+    }
+}
+
+void tune_all(void)
+{
+    const double timeout_ms = 10000;
+    char path[256];
+    char error[512];
+    std::vector<TuneEntry> plan;
+    get_arg(path, sizeof(path), "Enter plan file: ");
+    {   SnapshotReader snap;
+        check_connected(*snap);
+        if (!tune_load(path, *snap, plan, error, sizeof(error)))
+        {   report("error", "%s\n", error);
+            return;
+        }
+    }
+    // Set everything in one call, then watch snapshots for each radio to land
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    vrcc_call([&] { tune_apply(plan); });
+    size_t pending = plan.size();
+    double elapsed_ms = 0;
+    unsigned long sequence = 0;
+    for (int first = 1; pending && (elapsed_ms < timeout_ms); first = 0)
+    {   elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        {   SnapshotReader snap;
+            if (first || (snap->sequence != sequence))
+            {   sequence = snap->sequence;
+                for (size_t i = 0; i < plan.size(); i++)
+                {   if ((plan[i].latency_ms < 0) && tune_confirmed(*snap, plan[i]))
+                    {   plan[i].latency_ms = elapsed_ms;
+                        pending--;
+                    }
+                }
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    double max_ms = 0;
+    for (size_t i = 0; i < plan.size(); i++)
+    {   const TuneEntry& entry = plan[i];
+        max_ms = std::max(max_ms, entry.latency_ms);
+        if (Json_mode)
+        {   Json.begin("tune")
+                .field("radio", entry.radio)
+                .field("line", entry.line)
+                .flag("confirmed", entry.latency_ms >= 0)
+                .field("latency_ms", entry.latency_ms)
+                .end();
+        }
+        else if (entry.latency_ms >= 0)
+            printf("Radio %d: confirmed in %.1f ms\n", entry.radio, entry.latency_ms);
+        else
+            printf("Radio %d: not confirmed after %.0f ms\n", entry.radio, timeout_ms);
+    }
+    if (Json_mode)
+    {   Json.begin("tune_done")
+            .field("radios", (unsigned)plan.size())
+            .field("confirmed", (unsigned)(plan.size() - pending))
+            .field("max_ms", max_ms)
+            .end();
+    }
+    else
+        printf("Confirmed %u of %u radios, slowest %.1f ms.\n",
+               (unsigned)(plan.size() - pending), (unsigned)plan.size(), max_ms);
+}
+
+/// @brief Waits for a line of input from a terminal
+/// @details Other input is a script whose next line must not end a watch,
+/// so then this only sleeps.
+/// @returns 1 if a line is waiting
+static int wait_input(int ms)
+{
+    if (!Input.interactive)
+    {   std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        return 0;
+    }
+    if (memchr(Input.buf, '\n', Input.len))
+        return 1;
+#ifdef WIN32
+    return WAIT_OBJECT_0 == WaitForSingleObject(GetStdHandle(STD_INPUT_HANDLE), ms);
 #else
-    HANDLE eventHandles[] = {GetStdHandle(STD_INPUT_HANDLE)};
-    DWORD result = WSAWaitForMultipleEvents(1, eventHandles, FALSE, 0, TRUE);
-    switch (result)
-    {   case WSA_WAIT_EVENT_0:  // event on stdin
-            return 1;
-        case WSA_WAIT_TIMEOUT:  // no events
-        default:
-            break;
-    };
+    struct pollfd pfd = {Input.fd, POLLIN, 0};
+    return poll(&pfd, 1, ms) > 0;
 #endif
-    return 0;
+}
+
+static void print_watch(const WatchDomain* domain, const WatchChange& change)
+{
+    if (Json_mode)
+    {   Json.begin("watch")
+            .field("domain", domain->name)
+            .field("key", change.key)
+            .field("change", change.added ? "added" : (change.row ? "changed" : "removed"));
+        for (int f = 0; change.row && (f < domain->field_count); f++)
+        {   const WatchValue& value = change.row->values[f];
+            if (!(change.dirty & (1u << f)))
+                continue;
+            if (WATCH_FLAG == value.kind)
+                Json.flag(domain->fields[f], (int)value.number);
+            else if (WATCH_INT == value.kind)
+                Json.field(domain->fields[f], value.number);
+            else if (WATCH_REAL == value.kind)
+                Json.field(domain->fields[f], value.real);
+            else
+                Json.field(domain->fields[f], value.text);
+        }
+        Json.end();
+        return;
+    }
+    const char* space = change.key.empty() ? "" : " ";
+    if (!change.row)
+    {   printf("%s%s%s: removed\n", domain->row_name, space, change.key.c_str());
+        return;
+    }
+    printf("%s%s%s%s:", domain->row_name, space, change.key.c_str(), change.added ? " (new)" : "");
+    for (int f = 0; f < domain->field_count; f++)
+    {   const WatchValue& value = change.row->values[f];
+        if (!(change.dirty & (1u << f)))
+            continue;
+        if (WATCH_FLAG == value.kind)
+            printf(" %s=%s", domain->fields[f], value.number ? "true" : "false");
+        else if (WATCH_INT == value.kind)
+            printf(" %s=%lld", domain->fields[f], value.number);
+        else if (WATCH_REAL == value.kind)
+            printf(" %s=%.1f", domain->fields[f], value.real);
+        else
+            printf(" %s=\"%s\"", domain->fields[f], value.text.c_str());
+    }
+    printf("\n");
+}
+
+void watch(void)
+{
+    char name[32];
+    char msstr[32];
+    get_arg(name, sizeof(name), "Enter radios, jammers, calls or status: ");
+    const WatchDomain* domain = watch_find(name);
+    if (!domain)
+    {   report("error", "Cannot watch %s, expected radios, jammers, calls or status.\n", name);
+        return;
+    }
+    int ms = 1000;
+    if (count_args())
+    {   get_arg(msstr, sizeof(msstr), "");
+        ms = std::max(atoi(msstr), 10);
+    }
+    // Watch until Enter is pressed, or for 10 frames in a script
+    int frames = Input.interactive ? 0 : 10;
+    if (count_args())
+    {   get_arg(msstr, sizeof(msstr), "");
+        frames = atoi(msstr);
+    }
+    if (Input.interactive && !Json_mode)
+        printf("Watching %s, press Enter to stop.\n", domain->name);
+
+    Watcher watcher(domain);
+    std::vector<WatchChange> changes;
+    for (int frame = 0; !frames || (frame < frames); frame++)
+    {   if (frame && wait_input(ms))
+        {   char line[sizeof(Input.buf)];
+            get_input(line, sizeof(line));
+            break;
+        }
+        {   SnapshotReader snap;
+            watcher.update(*snap, changes);
+        }
+        for (size_t i = 0; i < changes.size(); i++)
+            print_watch(domain, changes[i]);
+        fflush(stdout);
+    }
 }
 
 void init(void)
@@ -543,29 +1819,109 @@ void init(void)
 #endif
 }
 
-int main(int argc, char* argv[])
+void on_input(void)
 {
-    init();
-    printf("VRCC C/C++ Library Sample Application\n\n");
-    printf("Type help to see available commands.\n\n");
+    char cmd[1024];
+    fill_input();
+    while (next_line(cmd, sizeof(cmd)))
+    {   execute(cmd);
+        if (!Json_mode)
+            printf("\n> ");
+        fflush(stdout);
+    }
+    if (Input.eof)
+        quit_app(); // End of input
+}
 
-    VRCC_Start(argc, argv);
+// Executes a script or piped input back to back, without prompts
+void run_batch(void)
+{
+    char line[1024];
+    while (get_input(line, sizeof(line)))
+    {   const char* cmd = line + strspn(line, " \t");
+        if ((0 == strlen(cmd)) || ('#' == cmd[0]))
+            continue;
+        if (!Json_mode)
+            printf("> %s\n", cmd);
+        execute(cmd);
+        if (!Json_mode)
+            printf("\n");
+        fflush(stdout);
+    }
+    // Report calls the script started but did not wait for
+    size_t running;
+    print_completions(&running);
+    while (running)
+    {   std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        print_completions(&running);
+    }
+    quit_app();
+}
 
-    char cmd[1024];
-    printf("> ");
+// Console wake: a blocking call finished while waiting for input
+void on_completion(void)
+{
+    // Over the prompt, which is reprinted after the completions
+    if (!Json_mode)
+        printf("\r");
+    if (print_completions(NULL) && !Json_mode)
+        printf("> ");
     fflush(stdout);
-    while(1)
-    {   if (input_available())
-        {   get_input(cmd, sizeof(cmd));
-            execute(cmd);
-            printf("\n> ");
-            fflush(stdout);
-        }
+}
+
+int main(int argc, char* argv[])
+{
+    const char* script = NULL;
+    int vrcc_argc = 0;
+    init();
+
+    // "-f script" and "--json" are ours, everything else is passed on to libvrcc
+    for (int i = 0; i < argc; i++)
+    {   if ((0 == strcmp(argv[i], "-f")) && (i + 1 < argc))
+            script = argv[++i];
+        else if (0 == strcmp(argv[i], "--json"))
+            Json_mode = 1;
         else
-        {   VRCC_Update(); // Must be called periodically to get updates
-            my_sleep(50);
-        }
+            argv[vrcc_argc++] = argv[i];
+    }
+    argv[vrcc_argc] = NULL;                 // VRCC_Start expects argv to stay NULL-terminated
+    Input.fd = script ? open(script, O_RDONLY) : fileno(stdin);
+    if (-1 == Input.fd)
+    {   perror(script);
+        return 1;
     }
+    Input.interactive = !script && isatty(Input.fd);
+
+    if (Input.interactive && !Json_mode)
+    {   printf("VRCC C/C++ Library Sample Application\n\n");
+        printf("Type help to see available commands.\n\n");
+    }
+
+    // libvrcc runs on its own thread, which calls VRCC_Update() periodically
+    vrcc_thread_start(vrcc_argc, argv);
+    vrcc_call([] {
+        jammer_on_complete([](const JammerStatus& status) {
+            std::lock_guard<std::mutex> lock(Jammer_done_lock);
+            Jammer_done.push_back(status);
+        });
+        inbox_on_invitation([](const InboxEntry& entry) {
+            std::lock_guard<std::mutex> lock(Invitations_lock);
+            Invitations.push_back(entry);
+        });
+    });
+
+    if (!Input.interactive)
+        run_batch();
+
+    Reactor console;
+    console.add_input(fileno(stdin), on_input);
+    console.set_wake(on_completion);
+    vrcc_on_completion([&console] { console.wake(); });
+
+    if (!Json_mode)
+        printf("> ");
+    fflush(stdout);
+    console.run();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -147,6 +147,28 @@ enum JammerRecordReplayState_t
     JAMMER_STATE_IDLE = 5,          ///< Idle state with audio recorded
 };
 
+/// Call progress state of an endpoint
+enum CallProgress_t
+{
+    CALL_STATE_NONE = 0,            ///< Not on the call
+    CALL_STATE_LEAVING = 10,        ///< Leaving the call
+    CALL_STATE_CONNECTED = 20,      ///< Connected to the call
+    CALL_STATE_SIGNALING = 30,      ///< Invited, not yet answered
+    CALL_STATE_HOLDING = 40         ///< On hold
+};
+
+/// Reason for leaving a call
+enum CallLeave_t
+{
+    CALL_LEAVE_UNSPECIFIED = 0,     ///< No reason given
+    CALL_LEAVE_REJECTED = 1,        ///< Invitation rejected
+    CALL_LEAVE_BUSY = 2,            ///< Endpoint is busy
+    CALL_LEAVE_NO_ANSWER = 3,       ///< Invitation not answered
+    CALL_LEAVE_HANG_UP = 4,         ///< Endpoint hung up
+    CALL_LEAVE_LOST_CONTACT = 5,    ///< Connection lost
+    CALL_LEAVE_REDIRECT = 6         ///< Call redirected
+};
+
 /// Error conditions
 enum Error_t
 {
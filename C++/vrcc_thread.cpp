@@ -0,0 +1,214 @@
+/*
+ *  Voisus SDK Example libvrcc update thread
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "vrcc_thread.h"
+#include "campaign.h"
+#include "inbox.h"
+#include "jammer_tracker.h"
+#include "meter.h"
+#include "reactor.h"
+#include "refresh.h"
+#include "snapshot.h"
+#include "vrcc_timed.h"
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Bounds of the adaptive VRCC_Update() tick: fast while state is changing,
+// backing off while the client is idle
+#define TICK_MIN_MS 5
+#define TICK_MAX_MS 100
+
+typedef struct {
+    std::function<void()> func;
+    std::promise<void>* done;
+} JOB_T;
+
+static Reactor* Owner_reactor;
+static std::thread Owner;
+static std::thread::id Owner_id;
+static std::mutex Jobs_lock;
+static std::vector<JOB_T> Jobs;
+static int Publish_pending;
+static std::mutex Completions_lock;
+static std::vector<Completion> Completions;
+static std::function<void()> Completion_notify;
+static unsigned long Completion_ids;
+static size_t Completions_running;
+
+static void publish(void)
+{
+    Publish_pending = !snapshot_publish();
+}
+
+// Every refresh may have re-read the invitations, so the inbox sees them all
+static unsigned int refresh(int update_changed)
+{
+    unsigned int refreshed = refresh_update(update_changed);
+    inbox_update(refreshed);
+    return refreshed;
+}
+
+static int update(void)
+{
+    // Campaign calls go out with this update rather than the next one
+    campaign_run();
+    int changed = VRCC_Update();
+    // Only domains whose version counter moved are re-enumerated
+    unsigned int refreshed = refresh(changed);
+    meter_sample();
+    jammer_track();
+    if (refreshed)
+        Publish_pending = 1;
+    if (Publish_pending)
+        publish();
+    // Stay on the fast tick while anything moves, so the activity sampler
+    // catches short receive/transmit events
+    return changed || refreshed || Publish_pending;
+}
+
+static void run_jobs(void)
+{
+    std::vector<JOB_T> jobs;
+    {   std::lock_guard<std::mutex> lock(Jobs_lock);
+        jobs.swap(Jobs);
+    }
+    for (size_t i = 0; i < jobs.size(); i++)
+        jobs[i].func();
+    // Calls may change state that readers are about to look at
+    refresh_invalidate_connection();
+    refresh(0);
+    publish();
+    for (size_t i = 0; i < jobs.size(); i++)
+    {   if (jobs[i].done)
+            jobs[i].done->set_value();
+    }
+}
+
+static void owner_main(int argc, char** argv, std::promise<int>* started)
+{
+    Reactor reactor(TICK_MIN_MS, TICK_MAX_MS);
+    reactor.set_tick(update);
+    reactor.set_wake(run_jobs);
+    reactor.set_deadline(campaign_next_ms);
+    Owner_reactor = &reactor;
+    Owner_id = std::this_thread::get_id();
+
+    int result = VRCC_Start(argc, argv);
+    refresh(1);
+    publish();
+    started->set_value(result);
+
+    reactor.run();
+    VRCC_Shutdown();
+}
+
+int vrcc_thread_start(int argc, char* argv[])
+{
+    std::promise<int> started;
+    std::future<int> result = started.get_future();
+    Owner = std::thread(owner_main, argc, argv, &started);
+    return result.get();
+}
+
+void vrcc_thread_stop(void)
+{
+    if (!Owner.joinable())
+        return;
+    vrcc_post([] { Owner_reactor->stop(); });
+    Owner.join();
+}
+
+static void push_job(const std::function<void()>& func, std::promise<void>* done)
+{
+    JOB_T job = {func, done};
+    {   std::lock_guard<std::mutex> lock(Jobs_lock);
+        Jobs.push_back(job);
+    }
+    Owner_reactor->wake();
+}
+
+void vrcc_post(const std::function<void()>& func)
+{
+    push_job(func, NULL);
+}
+
+void vrcc_call(const std::function<void()>& func)
+{
+    if (std::this_thread::get_id() == Owner_id)
+    {   func();
+        return;
+    }
+    std::promise<void> done;
+    std::future<void> finished = done.get_future();
+    push_job(func, &done);
+    finished.wait();
+}
+
+unsigned long vrcc_submit(const std::string& what, const std::function<std::string()>& func)
+{
+    unsigned long id;
+    {   std::lock_guard<std::mutex> lock(Completions_lock);
+        id = ++Completion_ids;
+        Completions_running++;
+    }
+    std::chrono::steady_clock::time_point queued = std::chrono::steady_clock::now();
+    vrcc_post([=] {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        Completion done;
+        done.id = id;
+        done.what = what;
+        done.result = func();
+        done.queued_ms = std::chrono::duration<double, std::milli>(start - queued).count();
+        done.run_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        // Readers must see the effect of the call by the time they hear of it
+        refresh_invalidate_connection();
+        refresh(0);
+        publish();
+        std::function<void()> notify;
+        {   std::lock_guard<std::mutex> lock(Completions_lock);
+            Completions.push_back(done);
+            Completions_running--;
+            notify = Completion_notify;
+        }
+        if (notify)
+            notify();
+    });
+    return id;
+}
+
+void vrcc_on_completion(const std::function<void()>& notify)
+{
+    std::lock_guard<std::mutex> lock(Completions_lock);
+    Completion_notify = notify;
+}
+
+size_t vrcc_completions(std::vector<Completion>& done)
+{
+    std::lock_guard<std::mutex> lock(Completions_lock);
+    done.insert(done.end(), Completions.begin(), Completions.end());
+    Completions.clear();
+    return Completions_running;
+}
@@ -0,0 +1,80 @@
+/*
+ *  Voisus SDK Example libvrcc update thread
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef VRCC_THREAD_H
+#define VRCC_THREAD_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+/// @brief Starts the thread that owns libvrcc
+/// @details libvrcc is not thread-safe, so a single thread starts it, runs
+/// VRCC_Update() on an adaptive tick and publishes a Snapshot after every
+/// change. Every other thread reads state through SnapshotReader and sends
+/// library calls to this thread with vrcc_call() or vrcc_post().
+/// @param argc Count of arguments passed to VRCC_Start
+/// @param argv NULL-terminated list of arguments passed to VRCC_Start
+/// @note This function is blocking and will return after VRCC_Start returns.
+/// @returns result of VRCC_Start
+int vrcc_thread_start(int argc, char* argv[]);
+
+/// @brief Shuts down libvrcc and joins its thread
+void vrcc_thread_stop(void);
+
+/// @brief Runs a function on the libvrcc thread without waiting for it
+void vrcc_post(const std::function<void()>& func);
+
+/// @brief Runs a function on the libvrcc thread and waits for it to return
+/// @details A snapshot publish is attempted before this returns, so a reader
+/// that follows usually sees the effect of the call. If a reader still pins
+/// the back buffer the publish is deferred to the next tick, and a call made
+/// on the libvrcc thread itself runs inline without one.
+void vrcc_call(const std::function<void()>& func);
+
+/// Result of a call run with vrcc_submit()
+struct Completion
+{
+    unsigned long       id;                 ///< Returned by vrcc_submit()
+    std::string         what;               ///< Description given to vrcc_submit()
+    std::string         result;             ///< Returned by the function
+    double              queued_ms;          ///< Time waiting behind other libvrcc work
+    double              run_ms;             ///< Time in the function
+};
+
+/// @brief Runs a function on the libvrcc thread and queues its result as a Completion
+/// @details The completion is queued after a snapshot publish is attempted,
+/// so readers usually see the effect of the call once it is delivered; a
+/// publish deferred by a pinned back buffer follows on the next tick.
+/// @returns ID of the completion, never 0
+unsigned long vrcc_submit(const std::string& what, const std::function<std::string()>& func);
+
+/// @brief Sets the function called on the libvrcc thread after each completion is queued
+/// @details Typically wakes the loop that drains the queue (see Reactor::wake).
+void vrcc_on_completion(const std::function<void()>& notify);
+
+/// @brief Takes every queued completion, oldest first
+/// @returns count of completions still running or waiting to run
+size_t vrcc_completions(std::vector<Completion>& done);
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ *  Voisus SDK Example timed libvrcc interface
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * \file vrcc_timed.h
+ * \brief libvrcc interface with per-call latency statistics
+ * \details Include this instead of vrcc.h. When VOISUS_API_STATS is defined,
+ * every call to a VRCC function is routed through an ApiTimer that records
+ * its latency (see the stats command). Taking the address of a function
+ * (e.g. passing Radio_Version as a callback) bypasses the timer.
+ */
+
+#ifndef VRCC_TIMED_H
+#define VRCC_TIMED_H
+
+#include "vrcc.h"
+
+#ifdef VOISUS_API_STATS
+
+#include "api_stats.h"
+
+#define VRCC_Start(...)                         VRCC_TIMED(VRCC_Start)(__VA_ARGS__)
+#define VRCC_Shutdown(...)                      VRCC_TIMED(VRCC_Shutdown)(__VA_ARGS__)
+#define VRCC_Update(...)                        VRCC_TIMED(VRCC_Update)(__VA_ARGS__)
+#define Voisus_ConnectServer(...)               VRCC_TIMED(Voisus_ConnectServer)(__VA_ARGS__)
+#define Voisus_Disconnect(...)                  VRCC_TIMED(Voisus_Disconnect)(__VA_ARGS__)
+#define Voisus_Error(...)                       VRCC_TIMED(Voisus_Error)(__VA_ARGS__)
+#define Voisus_Save(...)                        VRCC_TIMED(Voisus_Save)(__VA_ARGS__)
+#define Voisus_LogPath(...)                     VRCC_TIMED(Voisus_LogPath)(__VA_ARGS__)
+#define Voisus_ClientBuildVersion(...)          VRCC_TIMED(Voisus_ClientBuildVersion)(__VA_ARGS__)
+#define Voisus_ClientMsgVersion(...)            VRCC_TIMED(Voisus_ClientMsgVersion)(__VA_ARGS__)
+#define Voisus_ClientMsgDate(...)               VRCC_TIMED(Voisus_ClientMsgDate)(__VA_ARGS__)
+#define Voisus_ServerBuildVersion(...)          VRCC_TIMED(Voisus_ServerBuildVersion)(__VA_ARGS__)
+#define Voisus_ServerMsgVersion(...)            VRCC_TIMED(Voisus_ServerMsgVersion)(__VA_ARGS__)
+#define Voisus_ServerMsgDate(...)               VRCC_TIMED(Voisus_ServerMsgDate)(__VA_ARGS__)
+#define Voisus_MonitorPowerEvents(...)          VRCC_TIMED(Voisus_MonitorPowerEvents)(__VA_ARGS__)
+#define Voisus_SetServerMasterVolume(...)       VRCC_TIMED(Voisus_SetServerMasterVolume)(__VA_ARGS__)
+#define Voisus_SetServerSidetoneVolume(...)     VRCC_TIMED(Voisus_SetServerSidetoneVolume)(__VA_ARGS__)
+#define Network_TargetIP(...)                   VRCC_TIMED(Network_TargetIP)(__VA_ARGS__)
+#define Network_ClientIP(...)                   VRCC_TIMED(Network_ClientIP)(__VA_ARGS__)
+#define Network_ConnectionStatus(...)           VRCC_TIMED(Network_ConnectionStatus)(__VA_ARGS__)
+#define Network_ConnectState(...)               VRCC_TIMED(Network_ConnectState)(__VA_ARGS__)
+#define Network_ClientName(...)                 VRCC_TIMED(Network_ClientName)(__VA_ARGS__)
+#define Network_SetClientName(...)              VRCC_TIMED(Network_SetClientName)(__VA_ARGS__)
+#define Network_OperatorId(...)                 VRCC_TIMED(Network_OperatorId)(__VA_ARGS__)
+#define Network_CloudSet(...)                   VRCC_TIMED(Network_CloudSet)(__VA_ARGS__)
+#define Network_CloudActive(...)                VRCC_TIMED(Network_CloudActive)(__VA_ARGS__)
+#define Network_ConnectionMode(...)             VRCC_TIMED(Network_ConnectionMode)(__VA_ARGS__)
+#define Role_ListCount(...)                     VRCC_TIMED(Role_ListCount)(__VA_ARGS__)
+#define Role_Version(...)                       VRCC_TIMED(Role_Version)(__VA_ARGS__)
+#define Role_Name(...)                          VRCC_TIMED(Role_Name)(__VA_ARGS__)
+#define Role_Id(...)                            VRCC_TIMED(Role_Id)(__VA_ARGS__)
+#define Role_NameActive(...)                    VRCC_TIMED(Role_NameActive)(__VA_ARGS__)
+#define Role_IdActive(...)                      VRCC_TIMED(Role_IdActive)(__VA_ARGS__)
+#define Role_NameSet(...)                       VRCC_TIMED(Role_NameSet)(__VA_ARGS__)
+#define Role_IdSet(...)                         VRCC_TIMED(Role_IdSet)(__VA_ARGS__)
+#define Role_AutotuneEnabled(...)               VRCC_TIMED(Role_AutotuneEnabled)(__VA_ARGS__)
+#define Role_RadCtrlEnabled(...)                VRCC_TIMED(Role_RadCtrlEnabled)(__VA_ARGS__)
+#define Role_SetRole(...)                       VRCC_TIMED(Role_SetRole)(__VA_ARGS__)
+#define Role_CallingEnabled(...)                VRCC_TIMED(Role_CallingEnabled)(__VA_ARGS__)
+#define Role_CallPTTEnabled(...)                VRCC_TIMED(Role_CallPTTEnabled)(__VA_ARGS__)
+#define Role_ChatEnabled(...)                   VRCC_TIMED(Role_ChatEnabled)(__VA_ARGS__)
+#define Role_ChannelDisplayMap(...)             VRCC_TIMED(Role_ChannelDisplayMap)(__VA_ARGS__)
+#define EntityState_ListCount(...)              VRCC_TIMED(EntityState_ListCount)(__VA_ARGS__)
+#define EntityState_Version(...)                VRCC_TIMED(EntityState_Version)(__VA_ARGS__)
+#define EntityState_Name(...)                   VRCC_TIMED(EntityState_Name)(__VA_ARGS__)
+#define EntityState_Id(...)                     VRCC_TIMED(EntityState_Id)(__VA_ARGS__)
+#define EntityState_NameActive(...)             VRCC_TIMED(EntityState_NameActive)(__VA_ARGS__)
+#define EntityState_IdActive(...)               VRCC_TIMED(EntityState_IdActive)(__VA_ARGS__)
+#define EntityState_NameSet(...)                VRCC_TIMED(EntityState_NameSet)(__VA_ARGS__)
+#define EntityState_IdSet(...)                  VRCC_TIMED(EntityState_IdSet)(__VA_ARGS__)
+#define EntityState_SetEntityState(...)         VRCC_TIMED(EntityState_SetEntityState)(__VA_ARGS__)
+#define Headset_VoxThreshold(...)               VRCC_TIMED(Headset_VoxThreshold)(__VA_ARGS__)
+#define Headset_MicrophoneMode(...)             VRCC_TIMED(Headset_MicrophoneMode)(__VA_ARGS__)
+#define Headset_EarphoneVolume(...)             VRCC_TIMED(Headset_EarphoneVolume)(__VA_ARGS__)
+#define Headset_MicVolume(...)                  VRCC_TIMED(Headset_MicVolume)(__VA_ARGS__)
+#define Headset_SidetoneVolume(...)             VRCC_TIMED(Headset_SidetoneVolume)(__VA_ARGS__)
+#define Headset_HasSidetone(...)                VRCC_TIMED(Headset_HasSidetone)(__VA_ARGS__)
+#define Headset_SetHeadsetPreset(...)           VRCC_TIMED(Headset_SetHeadsetPreset)(__VA_ARGS__)
+#define Headset_SetVoxThreshold(...)            VRCC_TIMED(Headset_SetVoxThreshold)(__VA_ARGS__)
+#define Headset_SetMicrophoneMode(...)          VRCC_TIMED(Headset_SetMicrophoneMode)(__VA_ARGS__)
+#define Headset_SetCallMicrophoneMute(...)      VRCC_TIMED(Headset_SetCallMicrophoneMute)(__VA_ARGS__)
+#define Headset_SetEarphoneVolume(...)          VRCC_TIMED(Headset_SetEarphoneVolume)(__VA_ARGS__)
+#define Headset_SetMicVolume(...)               VRCC_TIMED(Headset_SetMicVolume)(__VA_ARGS__)
+#define Headset_SetSidetoneVolume(...)          VRCC_TIMED(Headset_SetSidetoneVolume)(__VA_ARGS__)
+#define Headset_DeviceConfigured(...)           VRCC_TIMED(Headset_DeviceConfigured)(__VA_ARGS__)
+#define PTT_SetPressed_Multi(...)               VRCC_TIMED(PTT_SetPressed_Multi)(__VA_ARGS__)
+#define PTT_SetPressed(...)                     VRCC_TIMED(PTT_SetPressed)(__VA_ARGS__)
+#define PTT_GetPressed_Multi(...)               VRCC_TIMED(PTT_GetPressed_Multi)(__VA_ARGS__)
+#define PTT_GetPressed(...)                     VRCC_TIMED(PTT_GetPressed)(__VA_ARGS__)
+#define PTT_HWGetPressed_Multi(...)             VRCC_TIMED(PTT_HWGetPressed_Multi)(__VA_ARGS__)
+#define PTT_HWGetPressed(...)                   VRCC_TIMED(PTT_HWGetPressed)(__VA_ARGS__)
+#define Radio_ListCount(...)                    VRCC_TIMED(Radio_ListCount)(__VA_ARGS__)
+#define Radio_Name(...)                         VRCC_TIMED(Radio_Name)(__VA_ARGS__)
+#define Radio_SetNet(...)                       VRCC_TIMED(Radio_SetNet)(__VA_ARGS__)
+#define Radio_SetNetRxFrequency(...)            VRCC_TIMED(Radio_SetNetRxFrequency)(__VA_ARGS__)
+#define Radio_NetRxFrequencyActive(...)         VRCC_TIMED(Radio_NetRxFrequencyActive)(__VA_ARGS__)
+#define Radio_SetNetTxFrequency(...)            VRCC_TIMED(Radio_SetNetTxFrequency)(__VA_ARGS__)
+#define Radio_NetTxFrequencyActive(...)         VRCC_TIMED(Radio_NetTxFrequencyActive)(__VA_ARGS__)
+#define Radio_SetNetCrypto(...)                 VRCC_TIMED(Radio_SetNetCrypto)(__VA_ARGS__)
+#define Radio_NetCryptoSystemActive(...)        VRCC_TIMED(Radio_NetCryptoSystemActive)(__VA_ARGS__)
+#define Radio_NetCryptoKeyActive(...)           VRCC_TIMED(Radio_NetCryptoKeyActive)(__VA_ARGS__)
+#define Radio_NetCryptoEnabledActive(...)       VRCC_TIMED(Radio_NetCryptoEnabledActive)(__VA_ARGS__)
+#define Radio_NetWaveformActive(...)            VRCC_TIMED(Radio_NetWaveformActive)(__VA_ARGS__)
+#define Radio_SetNetID(...)                     VRCC_TIMED(Radio_SetNetID)(__VA_ARGS__)
+#define Radio_NetListCount(...)                 VRCC_TIMED(Radio_NetListCount)(__VA_ARGS__)
+#define Radio_NetName(...)                      VRCC_TIMED(Radio_NetName)(__VA_ARGS__)
+#define Radio_NetNameActive(...)                VRCC_TIMED(Radio_NetNameActive)(__VA_ARGS__)
+#define Radio_NetID(...)                        VRCC_TIMED(Radio_NetID)(__VA_ARGS__)
+#define Radio_NetFrequency(...)                 VRCC_TIMED(Radio_NetFrequency)(__VA_ARGS__)
+#define Radio_NetWaveform(...)                  VRCC_TIMED(Radio_NetWaveform)(__VA_ARGS__)
+#define Radio_NetCryptoSystem(...)              VRCC_TIMED(Radio_NetCryptoSystem)(__VA_ARGS__)
+#define Radio_NetCryptoKey(...)                 VRCC_TIMED(Radio_NetCryptoKey)(__VA_ARGS__)
+#define Radio_NetCryptoEnabled(...)             VRCC_TIMED(Radio_NetCryptoEnabled)(__VA_ARGS__)
+#define Radio_NetFreqHopNetId(...)              VRCC_TIMED(Radio_NetFreqHopNetId)(__VA_ARGS__)
+#define Radio_NetSatcomChannel(...)             VRCC_TIMED(Radio_NetSatcomChannel)(__VA_ARGS__)
+#define Radio_NetTuningMethod(...)              VRCC_TIMED(Radio_NetTuningMethod)(__VA_ARGS__)
+#define Radio_NetIDActive(...)                  VRCC_TIMED(Radio_NetIDActive)(__VA_ARGS__)
+#define Radio_SetReceiveEnabled(...)            VRCC_TIMED(Radio_SetReceiveEnabled)(__VA_ARGS__)
+#define Radio_SetTransmitEnabled(...)           VRCC_TIMED(Radio_SetTransmitEnabled)(__VA_ARGS__)
+#define Radio_SetCryptoEnable(...)              VRCC_TIMED(Radio_SetCryptoEnable)(__VA_ARGS__)
+#define Radio_SetVolume(...)                    VRCC_TIMED(Radio_SetVolume)(__VA_ARGS__)
+#define Radio_SetVolumeStereo(...)              VRCC_TIMED(Radio_SetVolumeStereo)(__VA_ARGS__)
+#define Radio_SetBalance(...)                   VRCC_TIMED(Radio_SetBalance)(__VA_ARGS__)
+#define Radio_SetPTT(...)                       VRCC_TIMED(Radio_SetPTT)(__VA_ARGS__)
+#define Radio_SetRadioEffects(...)              VRCC_TIMED(Radio_SetRadioEffects)(__VA_ARGS__)
+#define Radio_IsReceiveEnabled(...)             VRCC_TIMED(Radio_IsReceiveEnabled)(__VA_ARGS__)
+#define Radio_IsTransmitEnabled(...)            VRCC_TIMED(Radio_IsTransmitEnabled)(__VA_ARGS__)
+#define Radio_IsReceiving(...)                  VRCC_TIMED(Radio_IsReceiving)(__VA_ARGS__)
+#define Radio_IsTransmitting(...)               VRCC_TIMED(Radio_IsTransmitting)(__VA_ARGS__)
+#define Radio_IsShared(...)                     VRCC_TIMED(Radio_IsShared)(__VA_ARGS__)
+#define Radio_Volume(...)                       VRCC_TIMED(Radio_Volume)(__VA_ARGS__)
+#define Radio_VolumeStereoLeft(...)             VRCC_TIMED(Radio_VolumeStereoLeft)(__VA_ARGS__)
+#define Radio_VolumeStereoRight(...)            VRCC_TIMED(Radio_VolumeStereoRight)(__VA_ARGS__)
+#define Radio_IsNetLocked(...)                  VRCC_TIMED(Radio_IsNetLocked)(__VA_ARGS__)
+#define Radio_IsRXModeLocked(...)               VRCC_TIMED(Radio_IsRXModeLocked)(__VA_ARGS__)
+#define Radio_IsTXModeLocked(...)               VRCC_TIMED(Radio_IsTXModeLocked)(__VA_ARGS__)
+#define Radio_Balance(...)                      VRCC_TIMED(Radio_Balance)(__VA_ARGS__)
+#define Radio_BalanceLocked(...)                VRCC_TIMED(Radio_BalanceLocked)(__VA_ARGS__)
+#define Radio_Type(...)                         VRCC_TIMED(Radio_Type)(__VA_ARGS__)
+#define Radio_CryptoEnabled(...)                VRCC_TIMED(Radio_CryptoEnabled)(__VA_ARGS__)
+#define Radio_Version(...)                      VRCC_TIMED(Radio_Version)(__VA_ARGS__)
+#define Radio_PTT(...)                          VRCC_TIMED(Radio_PTT)(__VA_ARGS__)
+#define Radio_RadioEffects(...)                 VRCC_TIMED(Radio_RadioEffects)(__VA_ARGS__)
+#define Radio_RadioEffectsLocked(...)           VRCC_TIMED(Radio_RadioEffectsLocked)(__VA_ARGS__)
+#define Radio_RadCtrlId(...)                    VRCC_TIMED(Radio_RadCtrlId)(__VA_ARGS__)
+#define Radio_AudioLevel(...)                   VRCC_TIMED(Radio_AudioLevel)(__VA_ARGS__)
+#define Radio_AudioLevelEnabled(...)            VRCC_TIMED(Radio_AudioLevelEnabled)(__VA_ARGS__)
+#define Radio_SetAudioLevelEnable(...)          VRCC_TIMED(Radio_SetAudioLevelEnable)(__VA_ARGS__)
+#define Radio_SetPlaysound(...)                 VRCC_TIMED(Radio_SetPlaysound)(__VA_ARGS__)
+#define Radio_Playsound(...)                    VRCC_TIMED(Radio_Playsound)(__VA_ARGS__)
+#define Radio_PlaysoundLocked(...)              VRCC_TIMED(Radio_PlaysoundLocked)(__VA_ARGS__)
+#define Log_Write(...)                          VRCC_TIMED(Log_Write)(__VA_ARGS__)
+#define Earshot_Enable(...)                     VRCC_TIMED(Earshot_Enable)(__VA_ARGS__)
+#define Earshot_SetPTT(...)                     VRCC_TIMED(Earshot_SetPTT)(__VA_ARGS__)
+#define Earshot_Receiving(...)                  VRCC_TIMED(Earshot_Receiving)(__VA_ARGS__)
+#define Earshot_Transmitting(...)               VRCC_TIMED(Earshot_Transmitting)(__VA_ARGS__)
+#define WorldPosition_Set(...)                  VRCC_TIMED(WorldPosition_Set)(__VA_ARGS__)
+#define Joystick_ListCount(...)                 VRCC_TIMED(Joystick_ListCount)(__VA_ARGS__)
+#define Joystick_Name(...)                      VRCC_TIMED(Joystick_Name)(__VA_ARGS__)
+#define Joystick_ButtonCount(...)               VRCC_TIMED(Joystick_ButtonCount)(__VA_ARGS__)
+#define Joystick_Active_Multi(...)              VRCC_TIMED(Joystick_Active_Multi)(__VA_ARGS__)
+#define Joystick_Active(...)                    VRCC_TIMED(Joystick_Active)(__VA_ARGS__)
+#define Joystick_ButtonActive_Multi(...)        VRCC_TIMED(Joystick_ButtonActive_Multi)(__VA_ARGS__)
+#define Joystick_ButtonActive(...)              VRCC_TIMED(Joystick_ButtonActive)(__VA_ARGS__)
+#define Joystick_Pressed_Multi(...)             VRCC_TIMED(Joystick_Pressed_Multi)(__VA_ARGS__)
+#define Joystick_Pressed(...)                   VRCC_TIMED(Joystick_Pressed)(__VA_ARGS__)
+#define Joystick_SetButton_Multi(...)           VRCC_TIMED(Joystick_SetButton_Multi)(__VA_ARGS__)
+#define Joystick_SetButton(...)                 VRCC_TIMED(Joystick_SetButton)(__VA_ARGS__)
+#define Codec_Get(...)                          VRCC_TIMED(Codec_Get)(__VA_ARGS__)
+#define Codec_Set(...)                          VRCC_TIMED(Codec_Set)(__VA_ARGS__)
+#define Call_GetLock(...)                       VRCC_TIMED(Call_GetLock)(__VA_ARGS__)
+#define Call_ReleaseLock(...)                   VRCC_TIMED(Call_ReleaseLock)(__VA_ARGS__)
+#define Call_Create(...)                        VRCC_TIMED(Call_Create)(__VA_ARGS__)
+#define Call_Invite(...)                        VRCC_TIMED(Call_Invite)(__VA_ARGS__)
+#define Call_Invite_Dial(...)                   VRCC_TIMED(Call_Invite_Dial)(__VA_ARGS__)
+#define Call_InviteCrew(...)                    VRCC_TIMED(Call_InviteCrew)(__VA_ARGS__)
+#define Call_IDFirst(...)                       VRCC_TIMED(Call_IDFirst)(__VA_ARGS__)
+#define Call_IDNext(...)                        VRCC_TIMED(Call_IDNext)(__VA_ARGS__)
+#define Call_ListCount(...)                     VRCC_TIMED(Call_ListCount)(__VA_ARGS__)
+#define Call_Endpoint_Version(...)              VRCC_TIMED(Call_Endpoint_Version)(__VA_ARGS__)
+#define Call_Endpoint_IDFirst(...)              VRCC_TIMED(Call_Endpoint_IDFirst)(__VA_ARGS__)
+#define Call_Endpoint_IDNext(...)               VRCC_TIMED(Call_Endpoint_IDNext)(__VA_ARGS__)
+#define Call_Endpoint_State(...)                VRCC_TIMED(Call_Endpoint_State)(__VA_ARGS__)
+#define Call_Invitation_Version(...)            VRCC_TIMED(Call_Invitation_Version)(__VA_ARGS__)
+#define Call_Invitation_First(...)              VRCC_TIMED(Call_Invitation_First)(__VA_ARGS__)
+#define Call_Invitation_Next(...)               VRCC_TIMED(Call_Invitation_Next)(__VA_ARGS__)
+#define Call_Invitation_ClearAll(...)           VRCC_TIMED(Call_Invitation_ClearAll)(__VA_ARGS__)
+#define Call_Progress(...)                      VRCC_TIMED(Call_Progress)(__VA_ARGS__)
+#define Call_Leave(...)                         VRCC_TIMED(Call_Leave)(__VA_ARGS__)
+#define Call_PressKey(...)                      VRCC_TIMED(Call_PressKey)(__VA_ARGS__)
+#define Call_LeaveRequest(...)                  VRCC_TIMED(Call_LeaveRequest)(__VA_ARGS__)
+#define Phone_ListCount(...)                    VRCC_TIMED(Phone_ListCount)(__VA_ARGS__)
+#define Phone_CallActive(...)                   VRCC_TIMED(Phone_CallActive)(__VA_ARGS__)
+#define Phone_Volume(...)                       VRCC_TIMED(Phone_Volume)(__VA_ARGS__)
+#define Phone_SetCall(...)                      VRCC_TIMED(Phone_SetCall)(__VA_ARGS__)
+#define Phone_SetVolume(...)                    VRCC_TIMED(Phone_SetVolume)(__VA_ARGS__)
+#define Voisus_ConnectCloud(...)                VRCC_TIMED(Voisus_ConnectCloud)(__VA_ARGS__)
+#define Cloud_GetLock(...)                      VRCC_TIMED(Cloud_GetLock)(__VA_ARGS__)
+#define Cloud_ReleaseLock(...)                  VRCC_TIMED(Cloud_ReleaseLock)(__VA_ARGS__)
+#define Cloud_IDFirst(...)                      VRCC_TIMED(Cloud_IDFirst)(__VA_ARGS__)
+#define Cloud_IDNext(...)                       VRCC_TIMED(Cloud_IDNext)(__VA_ARGS__)
+#define Cloud_ListCount(...)                    VRCC_TIMED(Cloud_ListCount)(__VA_ARGS__)
+#define Cloud_GetServerCount(...)               VRCC_TIMED(Cloud_GetServerCount)(__VA_ARGS__)
+#define Cloud_Version(...)                      VRCC_TIMED(Cloud_Version)(__VA_ARGS__)
+#define Operator_GetLock(...)                   VRCC_TIMED(Operator_GetLock)(__VA_ARGS__)
+#define Operator_ReleaseLock(...)               VRCC_TIMED(Operator_ReleaseLock)(__VA_ARGS__)
+#define Operator_IDFirst(...)                   VRCC_TIMED(Operator_IDFirst)(__VA_ARGS__)
+#define Operator_IDNext(...)                    VRCC_TIMED(Operator_IDNext)(__VA_ARGS__)
+#define Operator_ListCount(...)                 VRCC_TIMED(Operator_ListCount)(__VA_ARGS__)
+#define Operator_GetField(...)                  VRCC_TIMED(Operator_GetField)(__VA_ARGS__)
+#define Operator_Version(...)                   VRCC_TIMED(Operator_Version)(__VA_ARGS__)
+#define RadCtrl_ListCount(...)                  VRCC_TIMED(RadCtrl_ListCount)(__VA_ARGS__)
+#define RadCtrl_Name(...)                       VRCC_TIMED(RadCtrl_Name)(__VA_ARGS__)
+#define RadCtrl_Poll(...)                       VRCC_TIMED(RadCtrl_Poll)(__VA_ARGS__)
+#define RadCtrl_GetValueStr(...)                VRCC_TIMED(RadCtrl_GetValueStr)(__VA_ARGS__)
+#define RadCtrl_GetOptionsStr(...)              VRCC_TIMED(RadCtrl_GetOptionsStr)(__VA_ARGS__)
+#define RadCtrl_GetValueInt(...)                VRCC_TIMED(RadCtrl_GetValueInt)(__VA_ARGS__)
+#define RadCtrl_GetValueFloat(...)              VRCC_TIMED(RadCtrl_GetValueFloat)(__VA_ARGS__)
+#define RadCtrl_SetValueStr(...)                VRCC_TIMED(RadCtrl_SetValueStr)(__VA_ARGS__)
+#define RadCtrl_SetValueInt(...)                VRCC_TIMED(RadCtrl_SetValueInt)(__VA_ARGS__)
+#define RadCtrl_SetValueFloat(...)              VRCC_TIMED(RadCtrl_SetValueFloat)(__VA_ARGS__)
+#define RadCtrl_Error(...)                      VRCC_TIMED(RadCtrl_Error)(__VA_ARGS__)
+#define RadCtrl_ErrorVersion(...)               VRCC_TIMED(RadCtrl_ErrorVersion)(__VA_ARGS__)
+#define DIS_SetParams(...)                      VRCC_TIMED(DIS_SetParams)(__VA_ARGS__)
+#define DIS_GetParams(...)                      VRCC_TIMED(DIS_GetParams)(__VA_ARGS__)
+#define DIS_SetExercise(...)                    VRCC_TIMED(DIS_SetExercise)(__VA_ARGS__)
+#define DIS_GetExercise(...)                    VRCC_TIMED(DIS_GetExercise)(__VA_ARGS__)
+#define AuxAudio_Enable(...)                    VRCC_TIMED(AuxAudio_Enable)(__VA_ARGS__)
+#define AuxAudio_Send(...)                      VRCC_TIMED(AuxAudio_Send)(__VA_ARGS__)
+#define AuxAudio_Register(...)                  VRCC_TIMED(AuxAudio_Register)(__VA_ARGS__)
+#define RadioEffects_Version(...)               VRCC_TIMED(RadioEffects_Version)(__VA_ARGS__)
+#define RadioEffects_ListCount(...)             VRCC_TIMED(RadioEffects_ListCount)(__VA_ARGS__)
+#define RadioEffects_IDFirst(...)               VRCC_TIMED(RadioEffects_IDFirst)(__VA_ARGS__)
+#define RadioEffects_IDNext(...)                VRCC_TIMED(RadioEffects_IDNext)(__VA_ARGS__)
+#define RadioEffects_Name(...)                  VRCC_TIMED(RadioEffects_Name)(__VA_ARGS__)
+#define Jammer_Version(...)                     VRCC_TIMED(Jammer_Version)(__VA_ARGS__)
+#define Jammer_ListCount(...)                   VRCC_TIMED(Jammer_ListCount)(__VA_ARGS__)
+#define Jammer_NetListCount(...)                VRCC_TIMED(Jammer_NetListCount)(__VA_ARGS__)
+#define Jammer_NetName(...)                     VRCC_TIMED(Jammer_NetName)(__VA_ARGS__)
+#define Jammer_NetID(...)                       VRCC_TIMED(Jammer_NetID)(__VA_ARGS__)
+#define Jammer_NetIDActive(...)                 VRCC_TIMED(Jammer_NetIDActive)(__VA_ARGS__)
+#define Jammer_IsTransmitting(...)              VRCC_TIMED(Jammer_IsTransmitting)(__VA_ARGS__)
+#define Jammer_SetNetID(...)                    VRCC_TIMED(Jammer_SetNetID)(__VA_ARGS__)
+#define Jammer_SetEnable(...)                   VRCC_TIMED(Jammer_SetEnable)(__VA_ARGS__)
+#define Jammer_StartRecording(...)              VRCC_TIMED(Jammer_StartRecording)(__VA_ARGS__)
+#define Jammer_StopRecording(...)               VRCC_TIMED(Jammer_StopRecording)(__VA_ARGS__)
+#define Jammer_StartReplaying(...)              VRCC_TIMED(Jammer_StartReplaying)(__VA_ARGS__)
+#define Jammer_StopReplaying(...)               VRCC_TIMED(Jammer_StopReplaying)(__VA_ARGS__)
+#define Jammer_RecordReplayState(...)           VRCC_TIMED(Jammer_RecordReplayState)(__VA_ARGS__)
+#define Jammer_RecordReplayProgress(...)        VRCC_TIMED(Jammer_RecordReplayProgress)(__VA_ARGS__)
+#define Jammer_RecordReplayDurationMs(...)      VRCC_TIMED(Jammer_RecordReplayDurationMs)(__VA_ARGS__)
+#define AudioDevice_IDActive(...)               VRCC_TIMED(AudioDevice_IDActive)(__VA_ARGS__)
+#define AudioDevice_IDFirst(...)                VRCC_TIMED(AudioDevice_IDFirst)(__VA_ARGS__)
+#define AudioDevice_IDNext(...)                 VRCC_TIMED(AudioDevice_IDNext)(__VA_ARGS__)
+#define AudioDevice_Name(...)                   VRCC_TIMED(AudioDevice_Name)(__VA_ARGS__)
+#define AudioDevice_SetDevice(...)              VRCC_TIMED(AudioDevice_SetDevice)(__VA_ARGS__)
+#define AudioDevice_Version(...)                VRCC_TIMED(AudioDevice_Version)(__VA_ARGS__)
+#define License_Request(...)                    VRCC_TIMED(License_Request)(__VA_ARGS__)
+#define License_Release(...)                    VRCC_TIMED(License_Release)(__VA_ARGS__)
+#define License_Status(...)                     VRCC_TIMED(License_Status)(__VA_ARGS__)
+#define Playsound_ListCount(...)                VRCC_TIMED(Playsound_ListCount)(__VA_ARGS__)
+#define Playsound_Name(...)                     VRCC_TIMED(Playsound_Name)(__VA_ARGS__)
+#define Playsound_Id(...)                       VRCC_TIMED(Playsound_Id)(__VA_ARGS__)
+#define Playsound_Version(...)                  VRCC_TIMED(Playsound_Version)(__VA_ARGS__)
+
+#endif
+
+#endif
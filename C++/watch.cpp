@@ -0,0 +1,220 @@
+/*
+ *  Voisus SDK Example watch diffs
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "watch.h"
+#include <string.h>
+#include <unordered_map>
+
+static WatchValue number(long long value, int kind = WATCH_INT)
+{
+    WatchValue v = {kind, value, 0, std::string()};
+    return v;
+}
+
+static WatchValue real(double value)
+{
+    WatchValue v = {WATCH_REAL, 0, value, std::string()};
+    return v;
+}
+
+static WatchValue text(const std::string& value)
+{
+    WatchValue v = {WATCH_TEXT, 0, 0, value};
+    return v;
+}
+
+static int differs(const WatchValue& a, const WatchValue& b)
+{
+    switch (a.kind)
+    {   case WATCH_REAL:
+            return a.real != b.real;
+        case WATCH_TEXT:
+            return a.text != b.text;
+        default:
+            return a.number != b.number;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Domains
+///////////////////////////////////////////////////////////////////////////////
+
+static const char* const Radio_fields[] = {"net", "tx_enabled", "rx_enabled", "receiving", "transmitting",
+                                           "volume", "rx_frequency", "tx_frequency", "ptt"};
+
+static void collect_radios(const DomainCaches& snap, std::vector<WatchRow>& rows)
+{
+    const RadioTable& radios = *snap.radios;
+    rows.resize(radios.size());
+    for (int i = 0; i < (int)radios.size(); i++)
+    {   int flags = (*snap.radio_flags)[i];
+        WatchRow& row = rows[i];
+        row.key = std::to_string(i);
+        row.values.clear();
+        row.values.push_back(text(radios.net_name_active[i]));
+        row.values.push_back(number((flags & RADIO_TX_ENABLED) != 0, WATCH_FLAG));
+        row.values.push_back(number((flags & RADIO_RX_ENABLED) != 0, WATCH_FLAG));
+        row.values.push_back(number((flags & RADIO_RECEIVING) != 0, WATCH_FLAG));
+        row.values.push_back(number((flags & RADIO_TRANSMITTING) != 0, WATCH_FLAG));
+        row.values.push_back(real(radios.volume[i]));
+        row.values.push_back(number(radios.rx_frequency[i]));
+        row.values.push_back(number(radios.tx_frequency[i]));
+        row.values.push_back(number(radios.ptt[i]));
+    }
+}
+
+static const char* const Jammer_fields[] = {"net", "transmitting", "state", "progress", "duration_ms"};
+
+static void collect_jammers(const DomainCaches& snap, std::vector<WatchRow>& rows)
+{
+    const std::vector<JammerInfo>& jammers = *snap.jammers;
+    rows.resize(jammers.size());
+    for (int i = 0; i < (int)jammers.size(); i++)
+    {   const JammerInfo& jammer = jammers[i];
+        WatchRow& row = rows[i];
+        row.key = std::to_string(i);
+        row.values.clear();
+        row.values.push_back(text((jammer.net_active >= 0) ? jammer.nets[jammer.net_active].name : ""));
+        row.values.push_back(number(jammer.transmitting, WATCH_FLAG));
+        row.values.push_back(number(jammer.state));
+        row.values.push_back(number(jammer.progress));
+        row.values.push_back(number(jammer.duration_ms));
+    }
+}
+
+static const char* const Call_fields[] = {"state"};
+
+// One row per call endpoint, keyed "<call ID>/<endpoint ID>"
+static void collect_calls(const DomainCaches& snap, std::vector<WatchRow>& rows)
+{
+    rows.clear();
+    for (size_t c = 0; c < snap.calls->size(); c++)
+    {   const CallInfo& call = (*snap.calls)[c];
+        for (size_t e = 0; e < call.endpoints.size(); e++)
+        {   WatchRow row;
+            row.key = call.id + "/" + call.endpoints[e].id;
+            row.values.push_back(number(call.endpoints[e].state));
+            rows.push_back(row);
+        }
+    }
+}
+
+static const char* const Status_fields[] = {"target_ip", "client_name", "role", "connect_state", "connected", "ptt"};
+
+static void collect_status(const DomainCaches& snap, std::vector<WatchRow>& rows)
+{
+    const ConnectionInfo& conn = *snap.connection;
+    rows.resize(1);
+    rows[0].key = "";
+    rows[0].values.clear();
+    rows[0].values.push_back(text(conn.target_ip));
+    rows[0].values.push_back(text(conn.client_name));
+    rows[0].values.push_back(text(conn.role_name_active));
+    rows[0].values.push_back(number(conn.connect_state));
+    rows[0].values.push_back(number(conn.connection_status == STATUS_CONNECTED, WATCH_FLAG));
+    rows[0].values.push_back(number(conn.ptt_pressed, WATCH_FLAG));
+}
+
+#define FIELDS(f) f, (int)(sizeof(f) / sizeof(f[0]))
+
+static const WatchDomain Domains[] = {
+    {"radios", "radio", FIELDS(Radio_fields),
+     [](const DomainCaches& a, const DomainCaches& b) { return (int)((a.radios != b.radios) || (a.radio_flags != b.radio_flags)); },
+     collect_radios},
+    {"jammers", "jammer", FIELDS(Jammer_fields),
+     [](const DomainCaches& a, const DomainCaches& b) { return (int)(a.jammers != b.jammers); },
+     collect_jammers},
+    {"calls", "endpoint", FIELDS(Call_fields),
+     [](const DomainCaches& a, const DomainCaches& b) { return (int)(a.calls != b.calls); },
+     collect_calls},
+    {"status", "status", FIELDS(Status_fields),
+     [](const DomainCaches& a, const DomainCaches& b) { return (int)(a.connection != b.connection); },
+     collect_status}};
+
+const WatchDomain* watch_find(const char* name)
+{
+    for (size_t i = 0; i < sizeof(Domains) / sizeof(Domains[0]); i++)
+    {   if (0 == strcmp(Domains[i].name, name))
+            return &Domains[i];
+    }
+    return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Watcher
+///////////////////////////////////////////////////////////////////////////////
+
+Watcher::Watcher(const WatchDomain* domain)
+    : domain(domain),
+      first(1)
+{
+}
+
+size_t Watcher::update(const DomainCaches& snap, std::vector<WatchChange>& changes)
+{
+    changes.clear();
+    if (!first && !domain->changed(last, snap))
+        return 0;
+    std::vector<WatchRow> previous;
+    previous.swap(rows);
+    domain->collect(snap, rows);
+    last = snap;
+
+    // Rows usually keep their position, so only fall back to a key lookup
+    // when they do not
+    std::unordered_map<std::string, size_t> by_key;
+    std::vector<char> matched(previous.size());
+    for (size_t i = 0; i < rows.size(); i++)
+    {   size_t p = i;
+        if ((p >= previous.size()) || (previous[p].key != rows[i].key))
+        {   if (by_key.empty())
+            {   for (size_t j = 0; j < previous.size(); j++)
+                    by_key[previous[j].key] = j;
+            }
+            std::unordered_map<std::string, size_t>::const_iterator it = by_key.find(rows[i].key);
+            p = (it != by_key.end()) ? it->second : previous.size();
+        }
+        WatchChange change = {&rows[i], rows[i].key, 0, 0};
+        if (first || (p == previous.size()))
+        {   change.dirty = (domain->field_count < 32) ? (1u << domain->field_count) - 1 : ~0u;
+            change.added = 1;
+        }
+        else
+        {   matched[p] = 1;
+            for (int f = 0; f < domain->field_count; f++)
+            {   if (differs(previous[p].values[f], rows[i].values[f]))
+                    change.dirty |= 1u << f;
+            }
+        }
+        if (change.dirty)
+            changes.push_back(change);
+    }
+    for (size_t p = 0; p < previous.size(); p++)
+    {   if (!matched[p] && !first)
+        {   WatchChange change = {NULL, previous[p].key, 0, 0};
+            changes.push_back(change);
+        }
+    }
+    first = 0;
+    return changes.size();
+}
@@ -0,0 +1,104 @@
+/*
+ *  Voisus SDK Example watch diffs
+ *  Copyright 2017 Advanced Simulation Technology, inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef WATCH_H
+#define WATCH_H
+
+#include "refresh.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/// Type of a watched field
+enum WatchKind_t
+{
+    WATCH_INT,
+    WATCH_FLAG,
+    WATCH_REAL,
+    WATCH_TEXT
+};
+
+/// Value of a watched field
+struct WatchValue
+{
+    int                 kind;               ///< ::WatchKind_t
+    long long           number;             ///< WATCH_INT and WATCH_FLAG
+    double              real;               ///< WATCH_REAL
+    std::string         text;               ///< WATCH_TEXT
+};
+
+/// Values of one radio, jammer, call endpoint or the status, in field order
+struct WatchRow
+{
+    std::string         key;                ///< Identifies the row across frames
+    std::vector<WatchValue> values;
+};
+
+/// A domain that can be watched
+struct WatchDomain
+{
+    const char*         name;               ///< Command argument, e.g. "radios"
+    const char*         row_name;           ///< What a row is, e.g. "radio"
+    const char* const*  fields;             ///< Field names, at most 32
+    int                 field_count;
+    /// Returns 1 if the caches this domain reads differ (by pointer)
+    int (*changed)(const DomainCaches& last, const DomainCaches& snap);
+    /// Appends a row per item
+    void (*collect)(const DomainCaches& snap, std::vector<WatchRow>& rows);
+};
+
+/// Change to one row since the last frame
+struct WatchChange
+{
+    const WatchRow*     row;                ///< Current values, NULL if removed
+    std::string         key;
+    uint32_t            dirty;              ///< Bit per changed field, all set for a new row
+    int                 added;              ///< 1 if the row is new
+};
+
+/// @brief Finds a domain by name
+/// @returns domain, or NULL if unknown
+const WatchDomain* watch_find(const char* name);
+
+/// @brief Diffs successive snapshots of one domain field by field
+/// @details Caches that are shared with the last frame are skipped without
+/// looking at their contents.
+class Watcher
+{
+public:
+    Watcher(const WatchDomain* domain);
+
+    /// @brief Compares a snapshot with the last frame
+    /// @param changes Receives the changed rows; they point into this
+    /// watcher and are valid until the next update
+    /// @returns number of changed rows
+    size_t update(const DomainCaches& snap, std::vector<WatchChange>& changes);
+
+private:
+    const WatchDomain* domain;
+    DomainCaches last;
+    int first;
+    std::vector<WatchRow> rows;
+};
+
+#endif